@@ -1,277 +1,5291 @@
-/*
- * 01 Jan 2020
- * BrainFuck interpreter.
- * Written by Ayxan Haqverdili
- */
-
-#include <algorithm>
-#include <cassert>
-#include <cstdlib>
-#include <deque>
-#include <fstream>
-#include <iostream>
-#include <iterator>
-#include <stack>
-#include <utility>
-#include <vector>
-
-#ifdef _MSC_VER
-#include <ciso646>  // and/or/not
-#endif              // !_MSC_VER
-
-#ifdef __GNUC__
-# define pure_attribute [[gnu::pure]]
-# define const_attribute [[gnu::const]]
-#else
-# define pure_attribut
-# define const_attribute
-#endif // __GNUC__
-
-/* "Infinite" unsigned char buffer pointer */
-class Pointer {
-public:
-    using storage_type = std::deque<char>;
-    using size_type = storage_type::size_type;
-
-    explicit Pointer(size_type const preAllocatedMemory = 1)
-            : mem_(preAllocatedMemory), index_{ 0 } {
-        /* preAllocatedMemory must be at least 1 */
-        assert(preAllocatedMemory != 0);
-    }
-
-    auto& operator+=(size_type const c) {
-        index_ += c;
-        /* Allocate memory if needed. */
-        if (mem_.size() <= index_) mem_.resize(index_ + 1);
-        return *this;
-    }
-
-    auto operator++() -> Pointer& { return (*this += 1); }
-
-    auto& operator-=(size_type const c) noexcept {
-        assert(index_ - c < index_);
-        index_ -= c;
-        return *this;
-    }
-
-    auto operator--() noexcept -> Pointer& { return (*this -= 1); }
-
-    auto operator++(int) const->Pointer = delete; /* Expensive and pointless. Use preincrement instead */
-    auto operator--(int) const->Pointer = delete; /* Expensive and pointless. Use predecrement instead */
-
-    [[nodiscard]] auto operator*() const& -> const storage_type::value_type& {
-        assert(mem_.size() > index_);
-        return mem_[index_];
-    }
-
-    [[nodiscard]] auto operator*() & -> storage_type::value_type& {
-        return const_cast<storage_type::value_type&>(*std::as_const(*this));
-    }
-
-private:
-    [[no_unique_address]] storage_type mem_;
-    [[no_unique_address]] size_type index_;
-};
-
-/* A class that contains one of "><+-.,[]" and how many times it is supposed to be executed consecutively */
-class Command {
-public:
-    Command(char const ch, std::size_t const sz) : command_{ ch }, count_{ sz } {}
-    [[nodiscard]] auto command() const noexcept { return command_; }
-    [[nodiscard]] auto count() const noexcept { return count_; }
-
-    enum ActionableCommands : char {
-        PointerIncr = '>',
-        PointerDecr = '<',
-        CellValIncr = '+',
-        CellValDecr = '-',
-        Cout = '.',
-        Cin = ',',
-        LoopBegin = '[',
-        LoopEnd = ']',
-    };
-private:
-    char command_;
-    std::size_t count_;
-};
-
-const_attribute [[nodiscard]] bool operator==(Command const com, char const ch) noexcept {
-    return com.command() == ch;
-}
-
-const_attribute [[nodiscard]] bool operator!=(Command const com, char const ch) noexcept {
-    return not (com == ch);
-}
-
-template <char op, typename T1, typename T2> // Workaround for "-Wconversion" being buggy
-inline static void operation(T1& t, T2 const t2) noexcept {
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wconversion"
-#endif // __GNUC__
-
-    if constexpr (op == '+') t += static_cast<T1>(t2);
-    else if constexpr (op == '-') t -= static_cast<T1>(t2);
-
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif // __GNUC__
-}
-
-/* Return false if `ch` is a comment, true if it is a command() */
-bool interpret(Command const com, Pointer& p) {
-    auto const ch = com.command();
-    auto const count = com.count();
-    switch (ch) {
-        case Command::PointerIncr: {
-            p += count;
-            break;
-        }
-        case Command::PointerDecr: {
-            p -= count;
-            break;
-        }
-        case Command::CellValIncr: {
-            operation<'+'>(*p, count);
-            break;
-        }
-        case Command::CellValDecr: {
-            operation<'-'>(*p, count);
-            break;
-        }
-        case Command::Cout: {
-            std::fill_n(std::ostream_iterator<unsigned char>(std::cout), count, *p);
-            break;
-        }
-        case Command::Cin: {
-            for (std::size_t i = 0; i != count; ++i) {
-                std::cin >> *p;
-            }
-            break;
-        }
-        default: /* Everything else is a comment */
-            return false;
-    }
-    return true;
-}
-
-/* Skips from `[` to the corresponding `]` taking account nested loops. */
-template <typename BidirIter>
-[[nodiscard]] auto skipLoop(BidirIter p) noexcept {
-    assert(*p == Command::LoopBegin);
-    std::size_t bracketCount = 0;
-    do {
-        if (*p == Command::LoopBegin)
-            ++bracketCount;
-        else if (*p == Command::LoopEnd)
-            --bracketCount;
-        ++p;
-    } while (bracketCount != 0);
-    return p - 1;
-}
-
-/* Is `[` or `]` */
-const_attribute [[nodiscard]] auto isLoopCommand(char const ch) noexcept -> bool {
-    switch (ch) {
-        case Command::LoopBegin:
-        case Command::LoopEnd:
-            return true;
-        default:
-            return false;
-    }
-}
-
-/* Is one of the actionable 8 characters */
-const_attribute [[nodiscard]] auto isCommand(char const ch) noexcept -> bool {
-    switch (ch) {
-        case Command::LoopBegin:
-        case Command::LoopEnd:
-        case Command::PointerIncr:
-        case Command::PointerDecr:
-        case Command::CellValIncr:
-        case Command::CellValDecr:
-        case Command::Cout:
-        case Command::Cin:
-            return true;
-        default:
-            return false;
-    }
-}
-
-
-/* Skip all characters until for one `isCommand` returns true. */
-template <typename InputIter>
-[[ nodiscard ]] auto skipComment(InputIter beg, InputIter const end) {
-    while (beg != end and not isCommand(*beg)) ++beg;
-    return beg;
-}
-
-template <typename InputIter>
-[[nodiscard]] auto generateSourceCode(InputIter beg, InputIter const end) {
-    std::vector<Command> source_code;
-    while (beg != end) {
-        auto const ch = *beg;
-        std::size_t count = 0;
-        if (isLoopCommand(ch)) { // Executing more than 1 loop command doesn't work.
-            ++count;
-            ++beg;
-        }
-        else if (isCommand(ch)) { // Accumulate commands
-            while ((beg = skipComment(beg, end)) != end and *beg == ch) {
-                ++count;
-                ++beg;
-            }
-        }
-        else {
-            /* Everything else is a comment and is ignored. */
-            ++beg;
-        }
-        source_code.emplace_back(ch, count);
-    }
-    return source_code;
-}
-
-int main(int const argc, char* const argv[]) {
-    Pointer p;
-    if (argc < 2) {
-        std::cerr << "Source-code file name needed\n";
-        return EXIT_FAILURE;
-    }
-    std::ifstream f{ argv[1] };
-    if (not f.is_open()) {
-        std::cerr << "Can't open the source-code file \n";
-        return EXIT_FAILURE;
-    }
-    using StremIter = std::istream_iterator<char>;
-    const auto sourceCode = generateSourceCode(StremIter{ f }, StremIter{});
-
-    auto it = sourceCode.cbegin();
-    auto const end = sourceCode.cend();
-
-    std::stack<decltype(it)> loopPos; /* Here we log loops */
-    while (it != end) {
-        /* Firstly we consider loops  */
-        if (*it == Command::LoopBegin) {
-            /* If the current cell is zero, skip the loop. */
-            if (*p == 0) {
-                it = skipLoop(it);
-            }
-            else /* Else, log the loop starting */
-            {
-                loopPos.push(it);
-            }
-            ++it;
-        }
-        else if (*it == Command::LoopEnd) /* Jump to the last `]` */
-        {
-            assert(not loopPos.empty());
-            it = loopPos.top();
-            loopPos.pop();
-            /* don't increment `it` */
-        }
-        else {
-            interpret(*it, p);
-            ++it;
-        }
-    }
-}
+/*
+ * 01 Jan 2020
+ * BrainFuck interpreter.
+ * Written by Ayxan Haqverdili
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cerrno>
+#include <charconv>
+#include <csignal>
+#include <chrono>
+#include <condition_variable>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+# include <linux/futex.h>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/epoll.h>
+# include <sys/syscall.h>
+# include <ucontext.h>
+#endif // __linux__
+
+#if __has_include(<linux/io_uring.h>)
+# include <linux/io_uring.h>
+# define BF_HAVE_IO_URING 1
+#endif // __has_include(<linux/io_uring.h>)
+
+#if defined(__linux__) && defined(__x86_64__)
+# define BF_HAVE_JIT 1
+#endif // __linux__ && __x86_64__
+
+#ifdef _MSC_VER
+#include <ciso646>  // and/or/not
+#endif              // !_MSC_VER
+
+#ifdef __GNUC__
+# define pure_attribute [[gnu::pure]]
+# define const_attribute [[gnu::const]]
+#else
+# define pure_attribut
+# define const_attribute
+#endif // __GNUC__
+
+/* "Infinite" unsigned char buffer pointer */
+class Pointer {
+public:
+    using storage_type = std::deque<char>;
+    using size_type = storage_type::size_type;
+
+    explicit Pointer(size_type const preAllocatedMemory = 1)
+            : mem_(preAllocatedMemory), index_{ 0 } {
+        /* preAllocatedMemory must be at least 1 */
+        assert(preAllocatedMemory != 0);
+    }
+
+    /* Resume on a saved tape */
+    Pointer(storage_type cells, size_type const index) : mem_(std::move(cells)), index_{ index } {
+        if (mem_.size() <= index_) mem_.resize(index_ + 1);
+    }
+
+    auto& operator+=(size_type const c) {
+        index_ += c;
+        /* Allocate memory if needed. */
+        if (mem_.size() <= index_) mem_.resize(index_ + 1);
+        return *this;
+    }
+
+    auto operator++() -> Pointer& { return (*this += 1); }
+
+    auto& operator-=(size_type const c) {
+        if (c > index_) throw leftOfTape();
+        index_ -= c;
+        return *this;
+    }
+
+    auto operator--() -> Pointer& { return (*this -= 1); }
+
+    /* What moving left of the first cell throws; the JIT reports the same */
+    [[nodiscard]] static auto leftOfTape() -> std::out_of_range { return std::out_of_range{ "Pointer moved left of the first cell" }; }
+
+    auto operator++(int) const->Pointer = delete; /* Expensive and pointless. Use preincrement instead */
+    auto operator--(int) const->Pointer = delete; /* Expensive and pointless. Use predecrement instead */
+
+    /* Cells from the start of the tape */
+    [[nodiscard]] auto index() const noexcept { return index_; }
+
+    /* Cells allocated so far: one past the rightmost cell reached */
+    [[nodiscard]] auto size() const noexcept { return mem_.size(); }
+
+    [[nodiscard]] auto cells() const noexcept -> storage_type const& { return mem_; }
+
+    [[nodiscard]] auto operator*() const& -> const storage_type::value_type& {
+        assert(mem_.size() > index_);
+        return mem_[index_];
+    }
+
+    [[nodiscard]] auto operator*() & -> storage_type::value_type& {
+        return const_cast<storage_type::value_type&>(*std::as_const(*this));
+    }
+
+private:
+    [[no_unique_address]] storage_type mem_;
+    [[no_unique_address]] size_type index_;
+};
+
+/* A class that contains one of "><+-.,[]" and how many times it is supposed to be executed consecutively */
+class Command {
+public:
+    Command(char const ch, std::size_t const sz) : command_{ ch }, count_{ sz } {}
+    [[nodiscard]] auto command() const noexcept { return command_; }
+    [[nodiscard]] auto count() const noexcept { return count_; }
+
+    enum ActionableCommands : char {
+        PointerIncr = '>',
+        PointerDecr = '<',
+        CellValIncr = '+',
+        CellValDecr = '-',
+        Cout = '.',
+        Cin = ',',
+        LoopBegin = '[',
+        LoopEnd = ']',
+        /* Produced by the optimizer, never by the parser */
+        CellClear = '0',    /* `[-]` */
+        WriteLiteral = '"', /* count() is the index of the literal in `Program::literals` */
+    };
+private:
+    char command_;
+    std::size_t count_;
+};
+
+const_attribute [[nodiscard]] bool operator==(Command const com, char const ch) noexcept {
+    return com.command() == ch;
+}
+
+const_attribute [[nodiscard]] bool operator!=(Command const com, char const ch) noexcept {
+    return not (com == ch);
+}
+
+template <char op, typename T1, typename T2> // Workaround for "-Wconversion" being buggy
+inline static void operation(T1& t, T2 const t2) noexcept {
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif // __GNUC__
+
+    if constexpr (op == '+') t += static_cast<T1>(t2);
+    else if constexpr (op == '-') t -= static_cast<T1>(t2);
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif // __GNUC__
+}
+
+[[noreturn]] static void throwErrno(char const* const what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/* Receives the bytes produced by `.` whenever the output buffer is full or flushed. */
+class OutputBackend {
+public:
+    virtual ~OutputBackend() = default;
+    /* Consume `data` and hand back the buffer to keep writing into. */
+    [[nodiscard]] virtual auto flush(std::span<char> data) -> std::span<char> = 0;
+    /* Block until everything handed to `flush` has been written. */
+    virtual void finish() {}
+    /* Would `flush` return without waiting? */
+    [[nodiscard]] virtual auto ready() -> bool { return true; }
+};
+
+/* Supplies the bytes consumed by `,`. */
+class InputBackend {
+public:
+    virtual ~InputBackend() = default;
+    /* Next chunk of input; empty once the input is exhausted. */
+    [[nodiscard]] virtual auto refill() -> std::span<char const> = 0;
+    /* Would `refill` return without waiting? */
+    [[nodiscard]] virtual auto ready() -> bool { return true; }
+};
+
+/* Is there something to read on `fd` right now? (End of file and errors count too.) */
+[[nodiscard]] static auto pollReadable(int const fd) noexcept -> bool {
+    pollfd pfd{ fd, POLLIN, 0 };
+    return ::poll(&pfd, 1, 0) != 0;
+}
+
+inline constexpr std::size_t ioBufferSize = 1 << 16;
+
+static void writeAll(int const fd, char const* data, std::size_t size) {
+    while (size != 0) {
+        auto const written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throwErrno("write");
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+/* Plain synchronous write(2) */
+class FdOutput final : public OutputBackend {
+public:
+    explicit FdOutput(int const fd) : fd_{ fd }, buffer_(ioBufferSize) {}
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        writeAll(fd_, data.data(), data.size());
+        return buffer_;
+    }
+
+private:
+    int fd_;
+    std::vector<char> buffer_;
+};
+
+/* Plain synchronous read(2). Once `*interrupt` is set (by the signal handler that interrupts the
+ * read, for --timeout), the input ends instead of blocking on. */
+class FdInput final : public InputBackend {
+public:
+    explicit FdInput(int const fd, std::atomic<bool> const* const interrupt = nullptr)
+            : fd_{ fd }, interrupt_{ interrupt }, buffer_(ioBufferSize) {}
+
+    auto refill() -> std::span<char const> override {
+        for (;;) {
+            if (interrupt_ != nullptr and interrupt_->load(std::memory_order_relaxed)) return {};
+            auto const got = ::read(fd_, buffer_.data(), buffer_.size());
+            if (got >= 0) return { buffer_.data(), static_cast<std::size_t>(got) };
+            if (errno != EINTR) throwErrno("read");
+        }
+    }
+
+    auto ready() -> bool override { return pollReadable(fd_); }
+
+private:
+    int fd_;
+    std::atomic<bool> const* interrupt_;
+    std::vector<char> buffer_;
+};
+
+#ifdef BF_HAVE_IO_URING
+/* Block until there is something to read on `fd`, or a signal arrives */
+static void awaitReadable(int const fd) noexcept {
+    pollfd pfd{ fd, POLLIN, 0 };
+    (void)::poll(&pfd, 1, -1);
+}
+
+/* Minimal io_uring wrapper on top of the raw syscalls: one submitter, one outstanding request at a time. */
+class IoUring {
+public:
+    /* Returns nullptr if the kernel (or a seccomp filter) refuses io_uring. */
+    [[nodiscard]] static auto create() -> std::unique_ptr<IoUring> {
+        io_uring_params params{};
+        auto const fd = static_cast<int>(::syscall(__NR_io_uring_setup, 4, &params));
+        if (fd < 0) return nullptr;
+        std::unique_ptr<IoUring> ring{ new IoUring(fd) };
+        if (not ring->map(params)) return nullptr;
+        return ring;
+    }
+
+    IoUring(IoUring const&) = delete;
+    auto operator=(IoUring const&) -> IoUring& = delete;
+
+    ~IoUring() {
+        for (auto const& [addr, size] : maps_) ::munmap(addr, size);
+        ::close(fd_);
+    }
+
+    void submit(std::uint8_t const opcode, int const fd, void* const data, std::size_t const size) {
+        io_uring_sqe sqe{};
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.off = static_cast<std::uint64_t>(-1); /* Use (and advance) the file position */
+        sqe.addr = reinterpret_cast<std::uintptr_t>(data);
+        sqe.len = static_cast<std::uint32_t>(size);
+        sqe.user_data = reinterpret_cast<std::uintptr_t>(data);
+        push(sqe);
+    }
+
+    /* Cancel the request submitted on `data`. It and the cancellation both complete. */
+    void cancel(void* const data) {
+        io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_ASYNC_CANCEL;
+        sqe.fd = -1;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(data);
+        push(sqe);
+    }
+
+    [[nodiscard]] auto hasCompletion() const noexcept -> bool {
+        return *cqHead_ != std::atomic_ref{ *cqTail_ }.load(std::memory_order_acquire);
+    }
+
+    /* Wait for the next completion and return its result (bytes transferred or -errno). Returns
+     * nullopt, with the request still outstanding, once `*interrupt` is set. */
+    [[nodiscard]] auto wait(std::atomic<bool> const* const interrupt = nullptr) -> std::optional<std::int32_t> {
+        for (;;) {
+            auto const head = *cqHead_;
+            if (head != std::atomic_ref{ *cqTail_ }.load(std::memory_order_acquire)) {
+                auto const res = cqes_[head & *cqMask_].res;
+                std::atomic_ref{ *cqHead_ }.store(head + 1, std::memory_order_release);
+                return res;
+            }
+            if (interrupt != nullptr and interrupt->load(std::memory_order_relaxed)) return std::nullopt;
+            if (::syscall(__NR_io_uring_enter, fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0
+                and errno != EINTR)
+                throwErrno("io_uring_enter");
+        }
+    }
+
+private:
+    explicit IoUring(int const fd) noexcept : fd_{ fd } {}
+
+    void push(io_uring_sqe const& sqe) {
+        auto const tail = *sqTail_;
+        auto const index = tail & *sqMask_;
+        sqes_[index] = sqe;
+        sqArray_[index] = index;
+        std::atomic_ref{ *sqTail_ }.store(tail + 1, std::memory_order_release);
+        while (::syscall(__NR_io_uring_enter, fd_, 1, 0, 0, nullptr, 0) < 0) {
+            if (errno != EINTR) throwErrno("io_uring_enter");
+        }
+    }
+
+    [[nodiscard]] auto mapRegion(std::size_t const size, off_t const offset) -> char* {
+        auto* const addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        if (addr == MAP_FAILED) return nullptr;
+        maps_.emplace_back(addr, size);
+        return static_cast<char*>(addr);
+    }
+
+    [[nodiscard]] auto map(io_uring_params const& params) -> bool {
+        auto* const sq = mapRegion(params.sq_off.array + params.sq_entries * sizeof(unsigned), IORING_OFF_SQ_RING);
+        auto* const cq = mapRegion(params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe), IORING_OFF_CQ_RING);
+        auto* const sqes = mapRegion(params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES);
+        if (sq == nullptr or cq == nullptr or sqes == nullptr) return false;
+        sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        sqes_ = reinterpret_cast<io_uring_sqe*>(sqes);
+        return true;
+    }
+
+    int fd_;
+    std::vector<std::pair<void*, std::size_t>> maps_;
+    unsigned* sqTail_ = nullptr;
+    unsigned* sqMask_ = nullptr;
+    unsigned* sqArray_ = nullptr;
+    unsigned* cqHead_ = nullptr;
+    unsigned* cqTail_ = nullptr;
+    unsigned* cqMask_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+    io_uring_sqe* sqes_ = nullptr;
+};
+
+/* Double-buffered output: one buffer is being written by the kernel while execution fills the other. */
+class UringOutput final : public OutputBackend {
+public:
+    UringOutput(std::unique_ptr<IoUring> ring, int const fd)
+            : ring_{ std::move(ring) }, fd_{ fd }, buffers_{ std::vector<char>(ioBufferSize), std::vector<char>(ioBufferSize) } {}
+
+    ~UringOutput() override {
+        try { finish(); } catch (...) {} /* Errors are reported by an explicit finish() */
+    }
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        finish();
+        if (not data.empty()) {
+            inFlight_ = data;
+            ring_->submit(IORING_OP_WRITE, fd_, inFlight_.data(), inFlight_.size());
+        }
+        current_ ^= 1;
+        return buffers_[current_];
+    }
+
+    void finish() override {
+        while (not inFlight_.empty()) {
+            auto const res = *ring_->wait();
+            if (res < 0) {
+                inFlight_ = {};
+                errno = -res;
+                throwErrno("io_uring write");
+            }
+            /* Short write (e.g. a full pipe): resubmit the remainder. */
+            inFlight_ = inFlight_.subspan(static_cast<std::size_t>(res));
+            if (not inFlight_.empty()) ring_->submit(IORING_OP_WRITE, fd_, inFlight_.data(), inFlight_.size());
+        }
+    }
+
+private:
+    std::unique_ptr<IoUring> ring_;
+    int fd_;
+    std::vector<char> buffers_[2];
+    unsigned current_ = 0;
+    std::span<char> inFlight_;
+};
+
+/* Read-ahead input: the next read is already queued while the program consumes the current buffer.
+ * Like `FdInput`, the input ends once `*interrupt` is set. */
+class UringInput final : public InputBackend {
+public:
+    UringInput(std::unique_ptr<IoUring> ring, int const fd, std::atomic<bool> const* const interrupt = nullptr)
+            : ring_{ std::move(ring) }, fd_{ fd }, interrupt_{ interrupt },
+              buffers_{ std::vector<char>(ioBufferSize), std::vector<char>(ioBufferSize) } {}
+
+    /* The kernel may still be writing into the read-ahead buffer: cancel it and reap both completions */
+    ~UringInput() override {
+        if (not pending_) return;
+        try {
+            ring_->cancel(buffers_[current_].data());
+            (void)ring_->wait();
+            (void)ring_->wait();
+        }
+        catch (...) {} /* Nothing to report it to */
+    }
+
+    auto refill() -> std::span<char const> override {
+        if (eof_) return {};
+        if (not pending_) queue();
+        auto completion = ring_->wait(interrupt_);
+        while (completion and (*completion == -EINTR or *completion == -EAGAIN)) {
+            pending_ = false;
+            /* A non-blocking fd with nothing to read: sleep in poll(2) instead of resubmitting in a spin */
+            if (*completion == -EAGAIN) awaitReadable(fd_);
+            queue();
+            completion = ring_->wait(interrupt_);
+        }
+        if (not completion) {
+            eof_ = true; /* The read stays queued */
+            return {};
+        }
+        pending_ = false;
+        auto const res = *completion;
+        if (res < 0) {
+            errno = -res;
+            throwErrno("io_uring read");
+        }
+        auto const ready = std::span<char const>{ buffers_[current_].data(), static_cast<std::size_t>(res) };
+        if (res == 0) {
+            eof_ = true;
+            return ready;
+        }
+        current_ ^= 1;
+        queue();
+        return ready;
+    }
+
+    auto ready() -> bool override { return eof_ or ring_->hasCompletion() or pollReadable(fd_); }
+
+private:
+    void queue() {
+        ring_->submit(IORING_OP_READ, fd_, buffers_[current_].data(), buffers_[current_].size());
+        pending_ = true;
+    }
+
+    std::unique_ptr<IoUring> ring_;
+    int fd_;
+    std::atomic<bool> const* interrupt_;
+    std::vector<char> buffers_[2];
+    unsigned current_ = 0;
+    bool pending_ = false;
+    bool eof_ = false;
+};
+#endif // BF_HAVE_IO_URING
+
+/* Owns a file descriptor */
+class UniqueFd {
+public:
+    UniqueFd() noexcept = default;
+    explicit UniqueFd(int const fd) noexcept : fd_{ fd } {}
+    UniqueFd(UniqueFd&& other) noexcept : fd_{ std::exchange(other.fd_, -1) } {}
+    auto operator=(UniqueFd&& other) noexcept -> UniqueFd& {
+        std::swap(fd_, other.fd_);
+        return *this;
+    }
+    ~UniqueFd() {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    [[nodiscard]] auto get() const noexcept { return fd_; }
+    [[nodiscard]] explicit operator bool() const noexcept { return fd_ >= 0; }
+
+private:
+    int fd_ = -1;
+};
+
+[[nodiscard]] static auto isRegularFile(int const fd) noexcept -> bool {
+    struct stat st{};
+    return ::fstat(fd, &st) == 0 and S_ISREG(st.st_mode);
+}
+
+/* Serves the whole input file straight out of the page cache: `,` reads from the mapping, nothing is copied. */
+class MmapInput final : public InputBackend {
+public:
+    /* Returns nullptr if `fd` can't be mapped (not a regular file, ...). */
+    [[nodiscard]] static auto create(int const fd) -> std::unique_ptr<MmapInput> {
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 or not S_ISREG(st.st_mode)) return nullptr;
+        auto const size = static_cast<std::size_t>(st.st_size);
+        if (size == 0) return std::unique_ptr<MmapInput>{ new MmapInput(nullptr, 0) };
+        auto* const addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        if (addr == MAP_FAILED) return nullptr;
+        ::madvise(addr, size, MADV_SEQUENTIAL);
+        return std::unique_ptr<MmapInput>{ new MmapInput(static_cast<char const*>(addr), size) };
+    }
+
+    ~MmapInput() override {
+        if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    auto refill() -> std::span<char const> override {
+        return { data_, std::exchange(remaining_, 0) };
+    }
+
+    /* The whole mapped file */
+    [[nodiscard]] auto bytes() const noexcept -> std::string_view { return { data_, size_ }; }
+
+private:
+    MmapInput(char const* const data, std::size_t const size) noexcept : data_{ data }, size_{ size }, remaining_{ size } {}
+
+    char const* data_;
+    std::size_t size_;
+    std::size_t remaining_;
+};
+
+/* `.` writes straight into a shared mapping of the output file. The file is grown
+ * with fallocate a window at a time and truncated to the written size at the end. */
+class MmapOutput final : public OutputBackend {
+public:
+    static constexpr std::size_t windowSize = std::size_t{ 64 } << 20;
+
+    /* Returns nullptr if `fd` isn't a regular file. */
+    [[nodiscard]] static auto create(int const fd) -> std::unique_ptr<MmapOutput> {
+        if (not isRegularFile(fd)) return nullptr;
+        return std::unique_ptr<MmapOutput>{ new MmapOutput(fd) };
+    }
+
+    ~MmapOutput() override {
+        unmap();
+        ::ftruncate(fd_, static_cast<off_t>(written_));
+    }
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        if (window_ == nullptr) {
+            mapWindow(0);
+            return { window_, windowSize };
+        }
+        auto* const windowEnd = window_ + windowSize;
+        written_ = windowOffset_ + static_cast<std::size_t>(data.data() + data.size() - window_);
+        if (data.data() + data.size() == windowEnd) {
+            mapWindow(windowOffset_ + windowSize);
+            return { window_, windowSize };
+        }
+        return { data.data() + data.size(), windowEnd };
+    }
+
+    void finish() override {
+        if (::ftruncate(fd_, static_cast<off_t>(written_)) != 0) throwErrno("ftruncate");
+    }
+
+private:
+    explicit MmapOutput(int const fd) noexcept : fd_{ fd } {}
+
+    void mapWindow(std::size_t const offset) {
+        unmap();
+        auto const end = static_cast<off_t>(offset + windowSize);
+#ifdef __linux__
+        if (::fallocate(fd_, 0, static_cast<off_t>(offset), static_cast<off_t>(windowSize)) != 0)
+#endif // __linux__
+            if (::ftruncate(fd_, end) != 0) throwErrno("ftruncate");
+        auto* const addr = ::mmap(nullptr, windowSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, static_cast<off_t>(offset));
+        if (addr == MAP_FAILED) throwErrno("mmap");
+        window_ = static_cast<char*>(addr);
+        windowOffset_ = offset;
+    }
+
+    void unmap() noexcept {
+        if (window_ != nullptr) ::munmap(window_, windowSize);
+        window_ = nullptr;
+    }
+
+    int fd_;
+    char* window_ = nullptr;
+    std::size_t windowOffset_ = 0;
+    std::size_t written_ = 0;
+};
+
+/* Collects the output in memory, growing the string it writes into. */
+class StringOutput final : public OutputBackend {
+public:
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        if (data.data() != nullptr) size_ = static_cast<std::size_t>(data.data() + data.size() - storage_.data());
+        if (size_ == storage_.size()) storage_.resize(std::max(storage_.size() * 2, ioBufferSize));
+        return { storage_.data() + size_, storage_.size() - size_ };
+    }
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view { return { storage_.data(), size_ }; }
+
+    /* Start over, keeping the allocation */
+    void clear() noexcept { size_ = 0; }
+
+private:
+    std::string storage_;
+    std::size_t size_ = 0;
+};
+
+/* Serves input that is already in memory. */
+class MemoryInput final : public InputBackend {
+public:
+    explicit MemoryInput(std::string_view const data) noexcept : data_{ data } {}
+
+    auto refill() -> std::span<char const> override {
+        return { std::exchange(data_, {}) };
+    }
+
+private:
+    std::string_view data_;
+};
+
+enum class IoMode { Sync, Uring };
+
+/* io_uring if requested and usable, read(2)/write(2) otherwise */
+[[nodiscard]] auto makeOutputBackend(IoMode const mode, int const fd) -> std::unique_ptr<OutputBackend> {
+#ifdef BF_HAVE_IO_URING
+    if (mode == IoMode::Uring)
+        if (auto ring = IoUring::create())
+            return std::make_unique<UringOutput>(std::move(ring), fd);
+#endif // BF_HAVE_IO_URING
+    (void)mode;
+    return std::make_unique<FdOutput>(fd);
+}
+
+[[nodiscard]] auto makeInputBackend(IoMode const mode, int const fd, std::atomic<bool> const* const interrupt = nullptr)
+        -> std::unique_ptr<InputBackend> {
+#ifdef BF_HAVE_IO_URING
+    if (mode == IoMode::Uring)
+        if (auto ring = IoUring::create())
+            return std::make_unique<UringInput>(std::move(ring), fd, interrupt);
+#endif // BF_HAVE_IO_URING
+    (void)mode;
+    return std::make_unique<FdInput>(fd, interrupt);
+}
+
+/* Buffered writer in front of an `OutputBackend`. The fast path never leaves this class. */
+class Output {
+public:
+    explicit Output(OutputBackend& backend) : backend_{ &backend } { reset(backend_->flush({})); }
+
+    /* What a run printed before it failed still goes out, ahead of the error */
+    ~Output() {
+        if (cur_ != begin_) try { flush(); } catch (...) {} /* Errors are reported by an explicit flush() or close() */
+    }
+
+    Output(Output const&) = delete;
+    auto operator=(Output const&) -> Output& = delete;
+
+    void put(char const ch, std::size_t count) {
+        while (count != 0) {
+            if (cur_ == end_) flush();
+            auto const n = std::min(count, static_cast<std::size_t>(end_ - cur_));
+            cur_ = std::fill_n(cur_, n, ch);
+            count -= n;
+        }
+    }
+
+    void write(std::string_view bytes) {
+        while (not bytes.empty()) {
+            if (cur_ == end_) flush();
+            auto const n = std::min(bytes.size(), static_cast<std::size_t>(end_ - cur_));
+            cur_ = std::copy_n(bytes.data(), n, cur_);
+            bytes.remove_prefix(n);
+        }
+    }
+
+    void flush() {
+        flushed_ += static_cast<std::size_t>(cur_ - begin_);
+        reset(backend_->flush({ begin_, cur_ }));
+    }
+
+    /* Bytes written so far, flushed or not */
+    [[nodiscard]] auto bytesWritten() const noexcept -> std::size_t { return flushed_ + static_cast<std::size_t>(cur_ - begin_); }
+
+    /* Is the buffer full and would flushing it wait? */
+    [[nodiscard]] auto wouldBlock() -> bool { return cur_ == end_ and not backend_->ready(); }
+
+    /* Flush and wait for the backend to drain. */
+    void close() {
+        flush();
+        backend_->finish();
+    }
+
+    /* Drop what is buffered, for when its fd is gone */
+    void discard() noexcept { cur_ = begin_; }
+
+private:
+    void reset(std::span<char> const buffer) noexcept {
+        begin_ = cur_ = buffer.data();
+        end_ = begin_ + buffer.size();
+    }
+
+    OutputBackend* backend_;
+    std::size_t flushed_ = 0;
+    char* begin_ = nullptr;
+    char* cur_ = nullptr;
+    char* end_ = nullptr;
+};
+
+/* Buffered reader in front of an `InputBackend`. If given an `Output`, it is flushed right before
+ * `,` would block on an empty buffer, so prompts show up but batch runs never pay for a flush. */
+class Input {
+public:
+    explicit Input(InputBackend& backend, Output* const flushBeforeBlocking = nullptr) noexcept
+            : backend_{ &backend }, flushBeforeBlocking_{ flushBeforeBlocking } {}
+
+    /* Is the buffer empty and would refilling it wait? */
+    [[nodiscard]] auto wouldBlock() -> bool { return cur_ == end_ and not backend_->ready(); }
+
+    /* Returns false (leaving `ch` untouched) at end of input. */
+    [[nodiscard]] auto get(char& ch) -> bool {
+        if (cur_ == end_ and not refill()) return false;
+        ch = *cur_++;
+        return true;
+    }
+
+    /* Bytes consumed by `,` so far */
+    [[nodiscard]] auto bytesRead() const noexcept -> std::size_t { return refilled_ - static_cast<std::size_t>(end_ - cur_); }
+
+private:
+    [[nodiscard]] auto refill() -> bool {
+        if (flushBeforeBlocking_ != nullptr and not backend_->ready()) flushBeforeBlocking_->flush();
+        auto const chunk = backend_->refill();
+        cur_ = chunk.data();
+        end_ = cur_ + chunk.size();
+        refilled_ += chunk.size();
+        return not chunk.empty();
+    }
+
+    InputBackend* backend_;
+    Output* flushBeforeBlocking_;
+    std::size_t refilled_ = 0;
+    char const* cur_ = nullptr;
+    char const* end_ = nullptr;
+};
+
+/* Block while `word` still holds `expected`. Spurious wakeups are allowed. */
+static void futexWait(std::atomic<std::uint32_t>& word, std::uint32_t const expected) noexcept {
+#ifdef __linux__
+    ::syscall(SYS_futex, &word, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+    word.wait(expected);
+#endif // __linux__
+}
+
+static void futexWake(std::atomic<std::uint32_t>& word) noexcept {
+#ifdef __linux__
+    ::syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    word.notify_all();
+#endif // __linux__
+}
+
+/* Single-producer single-consumer byte ring. Both sides work on whole contiguous spans
+ * (batched publish/consume) and sleep on a futex instead of spinning when blocked. */
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t const capacity = std::size_t{ 1 } << 20)
+            : buffer_(capacity), mask_{ static_cast<std::uint32_t>(capacity - 1) } {
+        /* Capacity must be a power of two that fits the 32-bit (futex-sized) indices */
+        assert(capacity != 0 and (capacity & (capacity - 1)) == 0 and capacity <= (std::size_t{ 1 } << 31));
+    }
+
+    /* Producer: free space to write into; empty once the consumer has gone away. */
+    [[nodiscard]] auto writable() -> std::span<char> {
+        auto const tail = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            if (readerClosed_.load(std::memory_order_acquire)) return {};
+            auto const used = tail - head_.load(std::memory_order_acquire);
+            if (used != capacity()) {
+                auto const start = tail & mask_;
+                auto const size = std::min<std::size_t>(capacity() - used, capacity() - start);
+                return { buffer_.data() + start, size };
+            }
+            block(spaceEvents_, producerSleeping_, [&] {
+                return tail - head_.load() != capacity() or readerClosed_.load();
+            });
+        }
+    }
+
+    void publish(std::size_t const size) {
+        tail_.store(tail_.load(std::memory_order_relaxed) + static_cast<std::uint32_t>(size), std::memory_order_release);
+        wake(dataEvents_, consumerSleeping_);
+    }
+
+    void closeWriter() {
+        writerClosed_.store(true, std::memory_order_release);
+        wake(dataEvents_, consumerSleeping_);
+    }
+
+    /* Consumer: would `readable` return without blocking? */
+    [[nodiscard]] auto hasData() const noexcept -> bool {
+        return tail_.load(std::memory_order_acquire) != head_.load(std::memory_order_relaxed)
+            or writerClosed_.load(std::memory_order_acquire);
+    }
+
+    /* Consumer: bytes ready to read; empty once the producer is done and the ring is drained. */
+    [[nodiscard]] auto readable() -> std::span<char const> {
+        auto const head = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            auto const ready = tail_.load(std::memory_order_acquire) - head;
+            if (ready != 0) {
+                auto const start = head & mask_;
+                auto const size = std::min<std::size_t>(ready, capacity() - start);
+                return { buffer_.data() + start, size };
+            }
+            if (writerClosed_.load(std::memory_order_acquire)) {
+                /* The last publish may have raced with the close flag. */
+                if (tail_.load(std::memory_order_acquire) != head) continue;
+                return {};
+            }
+            block(dataEvents_, consumerSleeping_, [&] {
+                return tail_.load() != head or writerClosed_.load();
+            });
+        }
+    }
+
+    void consume(std::size_t const size) {
+        head_.store(head_.load(std::memory_order_relaxed) + static_cast<std::uint32_t>(size), std::memory_order_release);
+        wake(spaceEvents_, producerSleeping_);
+    }
+
+    void closeReader() {
+        readerClosed_.store(true, std::memory_order_release);
+        wake(spaceEvents_, producerSleeping_);
+    }
+
+private:
+    [[nodiscard]] auto capacity() const noexcept -> std::uint32_t { return static_cast<std::uint32_t>(buffer_.size()); }
+
+    /* Sleep until `ready()` holds. The event counter is sampled before announcing ourselves,
+     * so a wake that lands between the check and the futex call makes the wait return at once. */
+    template <typename Predicate>
+    static void block(std::atomic<std::uint32_t>& events, std::atomic<bool>& sleeping, Predicate const ready) {
+        for (int spin = 0; spin != 64; ++spin)
+            if (ready()) return;
+        auto const seen = events.load();
+        sleeping.store(true);
+        if (not ready()) futexWait(events, seen);
+        sleeping.store(false);
+    }
+
+    static void wake(std::atomic<std::uint32_t>& events, std::atomic<bool>& sleeping) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load()) {
+            events.fetch_add(1);
+            futexWake(events);
+        }
+    }
+
+    std::vector<char> buffer_;
+    std::uint32_t mask_;
+    alignas(64) std::atomic<std::uint32_t> head_{ 0 };
+    alignas(64) std::atomic<std::uint32_t> tail_{ 0 };
+    alignas(64) std::atomic<std::uint32_t> dataEvents_{ 0 };
+    std::atomic<bool> consumerSleeping_{ false };
+    std::atomic<bool> writerClosed_{ false };
+    alignas(64) std::atomic<std::uint32_t> spaceEvents_{ 0 };
+    std::atomic<bool> producerSleeping_{ false };
+    std::atomic<bool> readerClosed_{ false };
+};
+
+/* `.` of one pipeline stage, writing straight into the ring */
+class RingOutput final : public OutputBackend {
+public:
+    explicit RingOutput(SpscRing& ring) noexcept : ring_{ &ring } {}
+    ~RingOutput() override { finish(); }
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        if (data.data() != discard_.data()) ring_->publish(data.size());
+        auto const space = ring_->writable();
+        if (not space.empty()) return space;
+        /* Nobody reads any more: drop the output, like writing to a closed pipe. */
+        discard_.resize(ioBufferSize);
+        return discard_;
+    }
+
+    void finish() override {
+        if (not std::exchange(closed_, true)) ring_->closeWriter();
+    }
+
+private:
+    SpscRing* ring_;
+    std::vector<char> discard_;
+    bool closed_ = false;
+};
+
+/* `,` of one pipeline stage, reading straight out of the ring */
+class RingInput final : public InputBackend {
+public:
+    explicit RingInput(SpscRing& ring) noexcept : ring_{ &ring } {}
+    ~RingInput() override { ring_->closeReader(); }
+
+    auto refill() -> std::span<char const> override {
+        ring_->consume(std::exchange(pending_, 0));
+        auto const chunk = ring_->readable();
+        pending_ = chunk.size();
+        return chunk;
+    }
+
+    auto ready() -> bool override { return ring_->hasData(); }
+
+private:
+    SpscRing* ring_;
+    std::size_t pending_ = 0;
+};
+
+/* Return false if `ch` is a comment, true if it is a command() */
+bool interpret(Command const com, Pointer& p, Output& out, Input& in) {
+    auto const ch = com.command();
+    auto const count = com.count();
+    switch (ch) {
+        case Command::PointerIncr: {
+            p += count;
+            break;
+        }
+        case Command::PointerDecr: {
+            p -= count;
+            break;
+        }
+        case Command::CellValIncr: {
+            operation<'+'>(*p, count);
+            break;
+        }
+        case Command::CellValDecr: {
+            operation<'-'>(*p, count);
+            break;
+        }
+        case Command::Cout: {
+            out.put(*p, count);
+            break;
+        }
+        case Command::Cin: {
+            for (std::size_t i = 0; i != count and in.get(*p); ++i) {}
+            break;
+        }
+        case Command::CellClear: {
+            *p = 0;
+            break;
+        }
+        default: /* Everything else is a comment */
+            return false;
+    }
+    return true;
+}
+
+/* Skips from `[` to the corresponding `]` taking account nested loops. */
+template <typename BidirIter>
+[[nodiscard]] auto skipLoop(BidirIter p) noexcept {
+    assert(*p == Command::LoopBegin);
+    std::size_t bracketCount = 0;
+    do {
+        if (*p == Command::LoopBegin)
+            ++bracketCount;
+        else if (*p == Command::LoopEnd)
+            --bracketCount;
+        ++p;
+    } while (bracketCount != 0);
+    return p - 1;
+}
+
+/* Is `[` or `]` */
+const_attribute [[nodiscard]] auto isLoopCommand(char const ch) noexcept -> bool {
+    switch (ch) {
+        case Command::LoopBegin:
+        case Command::LoopEnd:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Is one of the actionable 8 characters */
+const_attribute [[nodiscard]] auto isCommand(char const ch) noexcept -> bool {
+    switch (ch) {
+        case Command::LoopBegin:
+        case Command::LoopEnd:
+        case Command::PointerIncr:
+        case Command::PointerDecr:
+        case Command::CellValIncr:
+        case Command::CellValDecr:
+        case Command::Cout:
+        case Command::Cin:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+/* Skip all characters until for one `isCommand` returns true. */
+template <typename InputIter>
+[[ nodiscard ]] auto skipComment(InputIter beg, InputIter const end) {
+    while (beg != end and not isCommand(*beg)) ++beg;
+    return beg;
+}
+
+/* Source characters `[begin, end)` a command was made from; comments inside are included */
+struct SourceSpan {
+    std::size_t begin;
+    std::size_t end;
+};
+
+/* If `spans` is given, it gets one entry per command, as offsets from the initial `beg`. */
+template <typename InputIter>
+[[nodiscard]] auto generateSourceCode(InputIter beg, InputIter const end, std::vector<SourceSpan>* const spans = nullptr) {
+    std::vector<Command> source_code;
+    auto const first = beg;
+    while (beg != end) {
+        auto const ch = *beg;
+        auto const start = beg;
+        auto last = beg; /* One past the last character of the command */
+        std::size_t count = 0;
+        if (isLoopCommand(ch)) { // Executing more than 1 loop command doesn't work.
+            ++count;
+            last = ++beg;
+        }
+        else if (isCommand(ch)) { // Accumulate commands
+            while ((beg = skipComment(beg, end)) != end and *beg == ch) {
+                ++count;
+                last = ++beg;
+            }
+        }
+        else {
+            /* Everything else is a comment and is ignored. */
+            ++beg;
+            continue;
+        }
+        source_code.emplace_back(ch, count);
+        if (spans != nullptr)
+            spans->push_back({ static_cast<std::size_t>(std::distance(first, start)), static_cast<std::size_t>(std::distance(first, last)) });
+    }
+    return source_code;
+}
+
+/* FNV-1a */
+[[nodiscard]] constexpr auto hashBytes(std::string_view const bytes, std::uint64_t hash = 0xcbf29ce484222325) noexcept -> std::uint64_t {
+    for (auto const ch : bytes) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+/* Parsed (and possibly optimized) program: the commands plus the constant pool `WriteLiteral` refers to */
+struct Program {
+    std::vector<Command> code;
+    std::string constants;
+    std::vector<std::pair<std::size_t, std::size_t>> literals; /* (offset, size) into `constants` */
+    /* Per command: commands from it to the end of its basic block (the next `[` or `]`, inclusive) */
+    std::vector<std::size_t> blockRemaining;
+    std::uint64_t fingerprint = 0; /* Hash of the compiled form: equal fingerprints behave the same */
+    std::vector<SourceSpan> sourceMap; /* Per command: where it came from, for profiles and reports */
+    std::size_t sourceBytes = 0;
+    std::size_t parsedCommands = 0; /* Before optimization */
+
+    [[nodiscard]] auto literal(std::size_t const index) const noexcept -> std::string_view {
+        auto const [offset, size] = literals[index];
+        return std::string_view{ constants }.substr(offset, size);
+    }
+};
+
+void computeBlockCosts(Program& program) {
+    auto const& code = program.code;
+    program.blockRemaining.assign(code.size(), 0);
+    std::size_t cost = 0;
+    for (auto i = code.size(); i-- > 0;) {
+        if (isLoopCommand(code[i].command())) cost = 0;
+        program.blockRemaining[i] = ++cost;
+    }
+}
+
+/* `[-]` and `[+]` -> `CellClear` */
+void foldClearLoops(Program& program) {
+    auto const& code = program.code;
+    auto const& map = program.sourceMap;
+    std::vector<Command> folded;
+    std::vector<SourceSpan> foldedMap;
+    folded.reserve(code.size());
+    foldedMap.reserve(code.size());
+    for (std::size_t i = 0; i != code.size(); ++i) {
+        if (i + 2 < code.size() and code[i] == Command::LoopBegin and code[i + 2] == Command::LoopEnd
+            and (code[i + 1] == Command::CellValDecr or code[i + 1] == Command::CellValIncr)
+            and code[i + 1].count() % 2 == 1) { /* An even step can miss zero and loop forever */
+            folded.emplace_back(Command::CellClear, 1);
+            foldedMap.push_back({ map[i].begin, map[i + 2].end });
+            i += 2;
+        }
+        else {
+            folded.push_back(code[i]);
+            foldedMap.push_back(map[i]);
+        }
+    }
+    program.code = std::move(folded);
+    program.sourceMap = std::move(foldedMap);
+}
+
+/* Track cell values known at compile time through straight-line code and turn every run of `.`
+ * printing known values, at whatever offsets, into a single `WriteLiteral`. The literal is emitted
+ * right before the next command that could be observed (`,`, a `.` of an unknown value, a loop
+ * boundary or a `<` that could leave the tape), so the output order is unchanged. */
+void foldOutputConstants(Program& program) {
+    std::vector<Command> folded;
+    std::vector<SourceSpan> foldedMap;
+    folded.reserve(program.code.size());
+    foldedMap.reserve(program.code.size());
+
+    std::map<std::ptrdiff_t, std::optional<unsigned char>> known; /* Relative to the tape origin of the current block */
+    bool untouchedIsZero = true; /* Before the first loop every cell not in `known` is still 0 */
+    std::ptrdiff_t offset = 0;
+    std::ptrdiff_t lowest = 0; /* Offsets at or above it have been reached, so are on the tape */
+    std::string pending;
+    SourceSpan pendingSpan{}; /* From the first `.` folded into `pending` to the last */
+
+    auto const value = [&]() -> std::optional<unsigned char> {
+        if (auto const found = known.find(offset); found != known.end()) return found->second;
+        if (untouchedIsZero) return 0;
+        return std::nullopt;
+    };
+    auto const flushPending = [&] {
+        if (pending.empty()) return;
+        folded.emplace_back(Command::WriteLiteral, program.literals.size());
+        foldedMap.push_back(pendingSpan);
+        program.literals.emplace_back(program.constants.size(), pending.size());
+        program.constants += pending;
+        pending.clear();
+    };
+    auto const forgetAll = [&] {
+        known.clear();
+        untouchedIsZero = false;
+        offset = 0;
+        lowest = 0;
+    };
+
+    for (std::size_t i = 0; i != program.code.size(); ++i) {
+        auto const com = program.code[i];
+        auto const count = com.count();
+        switch (com.command()) {
+            case Command::PointerIncr:
+                offset += static_cast<std::ptrdiff_t>(count);
+                break;
+            case Command::PointerDecr:
+                offset -= static_cast<std::ptrdiff_t>(count);
+                if (offset < lowest) { /* May throw: what was printed before must be out by then */
+                    flushPending();
+                    lowest = offset;
+                }
+                break;
+            case Command::CellValIncr:
+                if (auto v = value()) {
+                    operation<'+'>(*v, count);
+                    known[offset] = v;
+                }
+                break;
+            case Command::CellValDecr:
+                if (auto v = value()) {
+                    operation<'-'>(*v, count);
+                    known[offset] = v;
+                }
+                break;
+            case Command::CellClear:
+                known[offset] = 0;
+                break;
+            case Command::Cout:
+                if (auto const v = value()) {
+                    if (pending.empty()) pendingSpan.begin = program.sourceMap[i].begin;
+                    pendingSpan.end = program.sourceMap[i].end;
+                    pending.append(count, static_cast<char>(*v));
+                    continue; /* Folded into the literal */
+                }
+                flushPending();
+                break;
+            case Command::Cin:
+                flushPending();
+                known[offset] = std::nullopt;
+                break;
+            case Command::LoopBegin:
+                flushPending();
+                forgetAll();
+                break;
+            case Command::LoopEnd:
+                flushPending();
+                forgetAll();
+                known[0] = 0; /* The loop only exits on a zero cell */
+                break;
+            default:
+                break;
+        }
+        folded.push_back(com);
+        foldedMap.push_back(program.sourceMap[i]);
+    }
+    flushPending();
+    program.code = std::move(folded);
+    program.sourceMap = std::move(foldedMap);
+}
+
+/* Set from a signal handler (SIGALRM for --timeout); polled wherever the step budget is checked. */
+inline std::atomic<bool> timerExpired{ false };
+
+/* Clear `timerExpired` and have SIGALRM set it `seconds` of wall-clock time from now. Interval
+ * timers are not inherited across fork(), so a forked child has to call this itself. */
+void startTimeout(double const seconds) {
+    timerExpired.store(false, std::memory_order_relaxed);
+    struct sigaction action{};
+    action.sa_handler = [](int) { timerExpired.store(true, std::memory_order_relaxed); };
+    ::sigaction(SIGALRM, &action, nullptr);
+    itimerval timer{};
+    timer.it_value.tv_sec = static_cast<time_t>(seconds);
+    timer.it_value.tv_usec = static_cast<suseconds_t>((seconds - static_cast<double>(timer.it_value.tv_sec)) * 1e6);
+    ::setitimer(ITIMER_REAL, &timer, nullptr);
+}
+
+struct RunLimits {
+    std::size_t maxSteps = SIZE_MAX;                 /* Commands executed */
+    std::atomic<bool> const* interrupt = nullptr;   /* Stop once this turns true */
+    bool countSteps = false;                         /* Keep `Machine::steps()` exact even without a limit */
+
+    /* Without any of these the engine neither charges steps nor checks anything */
+    [[nodiscard]] auto active() const noexcept { return maxSteps != SIZE_MAX or interrupt != nullptr or countSteps; }
+};
+
+/* Observes a run command by command: `command(pc, tape)` is called before `code[pc]` executes.
+ * The engine is instantiated per probe type, so the plain engine (`NoProbe`) pays nothing. */
+struct NoProbe {
+    void command(std::size_t, Pointer const&) noexcept {}
+};
+
+/* The interpreter as a resumable state machine. `run<true>` returns instead of blocking when `,`
+ * finds no input ready or `.` finds the output backed up; calling it again picks up where it
+ * left off. `run<false>` runs to completion unless a limit stops it.
+ *
+ * Steps are charged a whole basic block at a time (`Program::blockRemaining`) and limits are only
+ * checked at loop back edges and I/O, so counting costs one add per block. */
+class Machine {
+public:
+    enum class Status { Finished, NeedInput, OutputFull, StepLimit, Interrupted };
+
+    /* Everything needed to resume a run between commands (outside a yielded `,`) */
+    struct Snapshot {
+        std::size_t pc = 0;
+        std::size_t charged = 0;
+        std::vector<std::size_t> loops;
+        Pointer::size_type index = 0;
+        Pointer::storage_type tape;
+    };
+
+    explicit Machine(Program const& program) noexcept : program_{ &program } {
+        assert(program.blockRemaining.size() == program.code.size());
+        if (not program.code.empty()) charged_ = program.blockRemaining[0];
+    }
+
+    Machine(Program const& program, Snapshot snapshot)
+            : program_{ &program }, p_{ std::move(snapshot.tape), snapshot.index }, pc_{ snapshot.pc },
+              loopPos_{ std::move(snapshot.loops) }, charged_{ snapshot.charged } {}
+
+    [[nodiscard]] auto snapshot() const -> Snapshot {
+        assert(cinDone_ == 0);
+        return { pc_, charged_, loopPos_, p_.index(), p_.cells() };
+    }
+
+    [[nodiscard]] auto pc() const noexcept { return pc_; }
+    [[nodiscard]] auto tape() const noexcept -> Pointer const& { return p_; }
+
+    /* Commands executed so far */
+    [[nodiscard]] auto steps() const noexcept -> std::size_t {
+        return pc_ == program_->code.size() ? charged_ : charged_ - program_->blockRemaining[pc_];
+    }
+
+    [[nodiscard]] auto tapeCells() const noexcept -> std::size_t { return p_.size(); }
+
+    /* Execute exactly one command, ignoring limits; false once the program has finished.
+     * Slow, for positioning a replay on an exact step. */
+    auto step(Output& out, Input& in) -> bool {
+        auto const& code = program_->code;
+        if (pc_ == code.size()) return false;
+        auto const com = code[pc_];
+        switch (com.command()) {
+            case Command::LoopBegin:
+                if (*p_ == 0) jump(static_cast<std::size_t>(skipLoop(code.begin() + static_cast<std::ptrdiff_t>(pc_)) - code.begin()) + 1);
+                else {
+                    loopPos_.push_back(pc_);
+                    jump(pc_ + 1);
+                }
+                break;
+            case Command::LoopEnd: {
+                auto const begin = loopPos_.back();
+                loopPos_.pop_back();
+                jump(begin);
+                break;
+            }
+            case Command::WriteLiteral:
+                out.write(program_->literal(com.count()));
+                ++pc_;
+                break;
+            default:
+                interpret(com, p_, out, in);
+                ++pc_;
+                break;
+        }
+        return true;
+    }
+
+    /* Stop at a check point once `steps()` would pass `maxSteps`. Unless `limits.active()`, steps
+     * are neither charged nor checked and `steps()` is meaningless afterwards. */
+    template <bool Yielding>
+    [[nodiscard]] auto run(Output& out, Input& in, RunLimits const& limits = {}) -> Status {
+        NoProbe probe;
+        return run<Yielding>(out, in, limits, probe);
+    }
+
+    template <bool Yielding, typename Probe>
+    [[nodiscard]] auto run(Output& out, Input& in, RunLimits const& limits, Probe& probe) -> Status {
+        return limits.active() ? run<Yielding, true>(out, in, limits, probe) : run<Yielding, false>(out, in, limits, probe);
+    }
+
+private:
+    /* The hot state, down to the code's address and size, is kept in locals for the duration:
+     * cells are written through a `char&`, which the compiler must assume could change anything
+     * in memory, so members would be reloaded after every write. The state goes back into the
+     * members on the way out, exceptions included. */
+    template <bool Yielding, bool Limited, typename Probe>
+    [[nodiscard]] auto run(Output& out, Input& in, RunLimits const& limits, Probe& probe) -> Status {
+        auto const* const code = program_->code.data();
+        auto const codeSize = program_->code.size();
+        auto const* const blockRemaining = program_->blockRemaining.data();
+        auto pc = pc_;
+        auto charged = charged_;
+        auto p = std::move(p_);
+        auto loopPos = std::move(loopPos_);
+        auto const limitReached = [&]() -> std::optional<Status> {
+            if constexpr (Limited) {
+                if (charged > limits.maxSteps) return Status::StepLimit;
+                if (limits.interrupt != nullptr and limits.interrupt->load(std::memory_order_relaxed)) return Status::Interrupted;
+            }
+            return std::nullopt;
+        };
+        /* Continue at `target`, charging its basic block */
+        auto const jump = [&](std::size_t const target) noexcept {
+            pc = target;
+            if constexpr (Limited) {
+                if (pc != codeSize) charged += blockRemaining[pc];
+            }
+        };
+
+        try {
+            while (pc != codeSize) {
+                auto const com = code[pc];
+                probe.command(pc, p);
+                switch (com.command()) {
+                    case Command::LoopBegin: {
+                        /* If the current cell is zero, skip the loop, else log the loop starting */
+                        if (*p == 0) jump(static_cast<std::size_t>(skipLoop(code + pc) - code) + 1);
+                        else {
+                            loopPos.push_back(std::size_t{ pc }); /* A copy, so `pc` stays in a register */
+                            jump(pc + 1);
+                        }
+                        break;
+                    }
+                    case Command::LoopEnd: { /* Jump to the last `[`, which tests the cell again */
+                        if (auto const stop = limitReached()) return save(*stop, pc, charged, p, loopPos);
+                        assert(not loopPos.empty());
+                        auto const begin = loopPos.back();
+                        loopPos.pop_back();
+                        jump(begin);
+                        break;
+                    }
+                    case Command::WriteLiteral: {
+                        if (auto const stop = limitReached()) return save(*stop, pc, charged, p, loopPos);
+                        if constexpr (Yielding) {
+                            if (out.wouldBlock()) return save(Status::OutputFull, pc, charged, p, loopPos);
+                        }
+                        out.write(program_->literal(com.count()));
+                        ++pc;
+                        break;
+                    }
+                    case Command::Cout: {
+                        if (auto const stop = limitReached()) return save(*stop, pc, charged, p, loopPos);
+                        if constexpr (Yielding) {
+                            if (out.wouldBlock()) return save(Status::OutputFull, pc, charged, p, loopPos);
+                        }
+                        interpret(com, p, out, in);
+                        ++pc;
+                        break;
+                    }
+                    case Command::Cin: {
+                        if (auto const stop = limitReached()) return save(*stop, pc, charged, p, loopPos);
+                        if constexpr (Yielding) {
+                            /* One byte at a time, so a partly read run can be resumed */
+                            for (; cinDone_ != com.count(); ++cinDone_) {
+                                if (in.wouldBlock()) return save(Status::NeedInput, pc, charged, p, loopPos);
+                                if (not in.get(*p)) break;
+                            }
+                            cinDone_ = 0;
+                        }
+                        else interpret(com, p, out, in);
+                        ++pc;
+                        /* A timeout cuts a blocked read short: stop before the program takes that for EOF */
+                        if (auto const stop = limitReached()) return save(*stop, pc, charged, p, loopPos);
+                        break;
+                    }
+                    /* The tape commands are spelt out rather than left to interpret() so they stay in
+                     * this loop, next to `p` */
+                    case Command::PointerIncr: {
+                        p += com.count();
+                        ++pc;
+                        break;
+                    }
+                    case Command::PointerDecr: {
+                        p -= com.count();
+                        ++pc;
+                        break;
+                    }
+                    case Command::CellValIncr: {
+                        operation<'+'>(*p, com.count());
+                        ++pc;
+                        break;
+                    }
+                    case Command::CellValDecr: {
+                        operation<'-'>(*p, com.count());
+                        ++pc;
+                        break;
+                    }
+                    case Command::CellClear: {
+                        *p = 0;
+                        ++pc;
+                        break;
+                    }
+                    default: {
+                        interpret(com, p, out, in);
+                        ++pc;
+                        break;
+                    }
+                }
+            }
+        }
+        catch (...) {
+            save(Status::Finished, pc, charged, p, loopPos);
+            throw;
+        }
+        return save(Status::Finished, pc, charged, p, loopPos);
+    }
+
+    /* Put run()'s locals back. The scalars are taken by value so that their addresses never
+     * escape the loop. */
+    auto save(Status const status, std::size_t const pc, std::size_t const charged, Pointer& p,
+              std::vector<std::size_t>& loopPos) noexcept -> Status {
+        pc_ = pc;
+        charged_ = charged;
+        p_ = std::move(p);
+        loopPos_ = std::move(loopPos);
+        return status;
+    }
+
+    /* Continue at `target`, charging its basic block */
+    void jump(std::size_t const target) noexcept {
+        pc_ = target;
+        if (pc_ != program_->code.size()) charged_ += program_->blockRemaining[pc_];
+    }
+
+    Program const* program_;
+    Pointer p_;
+    std::size_t pc_ = 0;
+    std::vector<std::size_t> loopPos_; /* Here we log loops */
+    std::size_t cinDone_ = 0;          /* Bytes of the current `,` run already read */
+    std::size_t charged_ = 0;          /* Steps up to the end of the current basic block */
+};
+
+struct Execution {
+    Machine::Status status;
+    std::size_t steps; /* 0 unless the limits were active */
+    std::size_t tapeCells = 0; /* 0 if not known (replayed from the result cache) */
+    bool cached = false;       /* Replayed from the result cache */
+};
+
+/* Run `program` on a fresh tape until it finishes or hits a limit */
+template <typename Probe = NoProbe>
+auto execute(Program const& program, Output& out, Input& in, RunLimits const& limits = {}, Probe&& probe = {}) -> Execution {
+    Machine machine{ program };
+    auto const status = machine.run<false>(out, in, limits, probe);
+    return { status, limits.active() ? machine.steps() : 0, machine.tapeCells() };
+}
+
+[[nodiscard]] auto fingerprint(Program const& program) noexcept -> std::uint64_t {
+    auto hash = hashBytes(program.constants);
+    for (auto const com : program.code) {
+        char bytes[1 + sizeof(std::uint64_t)] = { com.command() };
+        auto const count = static_cast<std::uint64_t>(com.count());
+        std::memcpy(bytes + 1, &count, sizeof count);
+        hash = hashBytes({ bytes, sizeof bytes }, hash);
+    }
+    return hash;
+}
+
+/* Hash of the nonzero cells and where they are, fed in increasing position order: tapes that
+ * only differ in how far they were allocated hash the same. */
+class TapeHasher {
+public:
+    void add(std::uint64_t const position, char const value) noexcept {
+        if (value == 0) return;
+        char bytes[sizeof position + 1];
+        std::memcpy(bytes, &position, sizeof position);
+        bytes[sizeof position] = value;
+        hash_ = hashBytes({ bytes, sizeof bytes }, hash_);
+    }
+
+    [[nodiscard]] auto value() const noexcept { return hash_; }
+
+private:
+    std::uint64_t hash_ = hashBytes({});
+};
+
+[[nodiscard]] auto hashTape(Pointer::storage_type const& cells) noexcept -> std::uint64_t {
+    TapeHasher hasher;
+    for (std::size_t i = 0; i != cells.size(); ++i) hasher.add(i, cells[i]);
+    return hasher.value();
+}
+
+/* Every `[` has its `]` and vice versa */
+[[nodiscard]] auto isBalanced(std::vector<Command> const& code) noexcept -> bool {
+    std::size_t depth = 0;
+    for (auto const com : code) {
+        if (com == Command::LoopBegin) ++depth;
+        else if (com == Command::LoopEnd and depth-- == 0) return false;
+    }
+    return depth == 0;
+}
+
+/* --counters: a group of hardware counters, read around each phase of a run. Events the CPU,
+ * the hypervisor or `perf_event_paranoid` refuse are left out; only user-space work is counted. */
+class PerfCounters {
+public:
+    static constexpr std::size_t eventCount = 5;
+    static constexpr std::array<char const*, eventCount> names{ "cycles", "instructions", "branch-misses", "L1d-misses", "dTLB-misses" };
+    using Values = std::array<std::optional<double>, eventCount>; /* Scaled if the group was multiplexed */
+
+    struct Phase {
+        char const* name;
+        Values values;
+        double seconds;
+    };
+
+    /* Without `hardware`, only the time of each phase is recorded */
+    explicit PerfCounters(bool const hardware = true) {
+        if (not hardware) return;
+#ifdef __linux__
+        constexpr auto cacheMiss = [](std::uint64_t const cache) {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+        constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, eventCount> events{ {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D) },
+            { PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_DTLB) },
+        } };
+        for (std::size_t i = 0; i != eventCount; ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof attr;
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.disabled = leader() < 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[i] = UniqueFd{ static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, leader(), PERF_FLAG_FD_CLOEXEC)) };
+            if (fds_[i]) order_.push_back(i);
+        }
+#endif // __linux__
+    }
+
+    [[nodiscard]] auto available() const noexcept -> bool { return leader() >= 0; }
+
+    /* Run `f` with the counters on and record them as phase `name` */
+    template <typename F>
+    void measure(char const* const name, F&& f) {
+#ifdef __linux__
+        if (available()) {
+            ::ioctl(leader(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ::ioctl(leader(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif // __linux__
+        auto const start = std::chrono::steady_clock::now();
+        std::forward<F>(f)();
+        auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Values values;
+#ifdef __linux__
+        std::array<std::uint64_t, 3 + eventCount> buffer{}; /* nr, time enabled, time running, values */
+        if (available() and ::ioctl(leader(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP) == 0
+            and ::read(leader(), buffer.data(), sizeof buffer) > 0 and buffer[2] != 0) {
+            auto const scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+            for (std::size_t i = 0; i != order_.size(); ++i) values[order_[i]] = static_cast<double>(buffer[3 + i]) * scale;
+        }
+#endif // __linux__
+        phases_.push_back({ name, values, seconds });
+    }
+
+    [[nodiscard]] auto phases() const noexcept -> std::span<Phase const> { return phases_; }
+
+    [[nodiscard]] auto seconds(std::string_view const name) const noexcept -> std::optional<double> {
+        for (auto const& phase : phases_)
+            if (phase.name == name) return phase.seconds;
+        return std::nullopt;
+    }
+
+private:
+    [[nodiscard]] auto leader() const noexcept -> int { return order_.empty() ? -1 : fds_[order_.front()].get(); }
+
+    std::array<UniqueFd, eventCount> fds_;
+    std::vector<std::size_t> order_; /* Events that opened, in group read order */
+    std::vector<Phase> phases_;
+};
+
+/* A table of the phases with IPC, then the execute phase per BF command if the count is known */
+void printCounters(std::ostream& os, PerfCounters const& counters, std::optional<std::size_t> const steps) {
+    auto const value = [](std::optional<double> const v, int const width) {
+        std::ostringstream cell;
+        if (v) cell << std::fixed << std::setprecision(0) << *v;
+        else cell << '-';
+        return std::string(static_cast<std::size_t>(std::max(width - static_cast<int>(cell.str().size()), 0)), ' ') + cell.str();
+    };
+    os << "Hardware counters (user space):\n" << std::setw(9) << "phase" << std::setw(12) << "seconds";
+    for (auto const name : PerfCounters::names) os << std::setw(15) << name;
+    os << std::setw(8) << "IPC" << '\n';
+    for (auto const& phase : counters.phases()) {
+        os << std::setw(9) << phase.name << std::setw(12) << std::setprecision(6) << std::fixed << phase.seconds << std::defaultfloat;
+        for (auto const v : phase.values) os << value(v, 15);
+        auto const& [cycles, instructions] = std::pair{ phase.values[0], phase.values[1] };
+        if (cycles and instructions and *cycles > 0) os << std::setw(8) << std::fixed << std::setprecision(2) << *instructions / *cycles << std::defaultfloat;
+        os << '\n';
+    }
+    if (not steps or *steps == 0) return;
+    for (auto const& phase : counters.phases()) {
+        if (std::string_view{ phase.name } != "execute") continue;
+        os << "Per BF command (" << *steps << " executed):";
+        for (std::size_t i = 0; i != PerfCounters::eventCount; ++i)
+            if (phase.values[i]) os << ' ' << std::setprecision(4) << *phase.values[i] / static_cast<double>(*steps) << ' ' << PerfCounters::names[i];
+        os << '\n';
+    }
+}
+
+/* Parse and optimize; throws std::invalid_argument for unbalanced brackets. With `counters`, the
+ * two phases are measured separately. */
+[[nodiscard]] auto compileProgram(std::string_view const source, int const optimizationLevel, PerfCounters* const counters = nullptr) -> Program {
+    auto const phase = [&](char const* const name, auto&& f) {
+        if (counters != nullptr) counters->measure(name, f);
+        else f();
+    };
+    Program program;
+    phase("parse", [&] { program.code = generateSourceCode(source.begin(), source.end(), &program.sourceMap); });
+    program.sourceBytes = source.size();
+    program.parsedCommands = program.code.size();
+    if (not isBalanced(program.code)) throw std::invalid_argument("Unbalanced brackets");
+    phase("optimize", [&] {
+        if (optimizationLevel > 0) {
+            foldClearLoops(program);
+            foldOutputConstants(program);
+        }
+        computeBlockCosts(program);
+        program.fingerprint = fingerprint(program);
+    });
+    return program;
+}
+
+[[nodiscard]] auto loadProgram(char const* const path, int const optimizationLevel, PerfCounters* const counters = nullptr) -> std::optional<Program> {
+    std::ifstream f{ path, std::ios::binary };
+    if (not f.is_open()) {
+        std::cerr << "Can't open the source-code file " << path << '\n';
+        return std::nullopt;
+    }
+    std::string const source{ std::istreambuf_iterator<char>{ f }, std::istreambuf_iterator<char>{} };
+    return compileProgram(source, optimizationLevel, counters);
+}
+
+[[nodiscard]] auto readWholeFile(char const* const path) -> std::optional<std::string> {
+    std::ifstream f{ path, std::ios::binary };
+    if (not f.is_open()) return std::nullopt;
+    return std::string{ std::istreambuf_iterator<char>{ f }, std::istreambuf_iterator<char>{} };
+}
+
+/* "line:column  commands", the commands cut short after 40 source characters */
+[[nodiscard]] auto describeSpan(std::string_view const source, SourceSpan const span) -> std::string {
+    auto const before = source.substr(0, span.begin);
+    auto const line = std::count(before.begin(), before.end(), '\n') + 1;
+    auto const lineStart = before.rfind('\n');
+    auto const column = span.begin - (lineStart == std::string_view::npos ? 0 : lineStart + 1) + 1;
+    auto text = std::to_string(line) + ':' + std::to_string(column) + "  ";
+    for (auto const ch : source.substr(span.begin, std::min<std::size_t>(span.end - span.begin, 40)))
+        if (isCommand(ch)) text += ch;
+    return text;
+}
+
+/* --profile: how often each compiled command ran */
+struct ExecutionCounts {
+    explicit ExecutionCounts(Program const& program) : counts(program.code.size()) {}
+    void command(std::size_t const pc, Pointer const&) noexcept { ++counts[pc]; }
+
+    std::vector<std::uint64_t> counts;
+};
+
+/* Does source character `ch` belong to `com`? A command's span can also cover comments and, for
+ * `WriteLiteral`, the unfolded arithmetic between the `.`s it replaced. */
+const_attribute [[nodiscard]] auto attributes(Command const com, char const ch) noexcept -> bool {
+    switch (com.command()) {
+        case Command::WriteLiteral: return ch == Command::Cout;
+        case Command::CellClear: return isCommand(ch);
+        default: return ch == com.command();
+    }
+}
+
+/* Per source character: executions of the command it was compiled into (0 for comments) */
+[[nodiscard]] auto sourceCounts(std::string_view const source, Program const& program, std::vector<std::uint64_t> const& counts)
+        -> std::vector<std::uint64_t> {
+    std::vector<std::uint64_t> perChar(source.size());
+    for (std::size_t pc = 0; pc != program.code.size(); ++pc) {
+        auto const [begin, end] = program.sourceMap[pc];
+        for (auto i = begin; i != end and i < source.size(); ++i)
+            if (attributes(program.code[pc], source[i])) perChar[i] = counts[pc];
+    }
+    return perChar;
+}
+
+/* The source, line by line, after the executions of the line's commands. With `colour`, each
+ * command character is shaded from blue (cold) to red (hot) on a log scale; commands that never
+ * ran are grey. */
+void printProfile(std::ostream& os, std::string_view const source, Program const& program,
+                  std::vector<std::uint64_t> const& counts, bool const colour) {
+    auto const perChar = sourceCounts(source, program, counts);
+    auto const hottest = std::max<std::uint64_t>(perChar.empty() ? 0 : *std::max_element(perChar.begin(), perChar.end()), 2);
+    auto const total = std::accumulate(perChar.begin(), perChar.end(), std::uint64_t{ 0 });
+    constexpr char const* shades[] = { "\x1b[34m", "\x1b[36m", "\x1b[32m", "\x1b[33m", "\x1b[31m", "\x1b[1;31m" };
+
+    os << "Profile: " << total << " source commands executed\n";
+    for (std::size_t lineBegin = 0; lineBegin < source.size();) {
+        auto lineEnd = source.find('\n', lineBegin);
+        if (lineEnd == std::string_view::npos) lineEnd = source.size();
+        auto const lineTotal = std::accumulate(perChar.begin() + static_cast<std::ptrdiff_t>(lineBegin),
+                                               perChar.begin() + static_cast<std::ptrdiff_t>(lineEnd), std::uint64_t{ 0 });
+        os << std::setw(14) << lineTotal << " | ";
+        char const* current = nullptr;
+        for (auto i = lineBegin; i != lineEnd; ++i) {
+            if (colour) {
+                char const* shade = "\x1b[0m";
+                if (isCommand(source[i])) {
+                    auto const heat = std::log2(static_cast<double>(perChar[i])) / std::log2(static_cast<double>(hottest));
+                    shade = perChar[i] == 0 ? "\x1b[90m" : shades[std::min<std::size_t>(static_cast<std::size_t>(heat * 6), 5)];
+                }
+                if (shade != current) os << (current = shade);
+            }
+            os << source[i];
+        }
+        if (colour) os << "\x1b[0m";
+        os << '\n';
+        lineBegin = lineEnd + 1;
+    }
+
+    std::vector<std::size_t> order(counts.size());
+    std::iota(order.begin(), order.end(), std::size_t{ 0 });
+    auto const shown = std::min<std::size_t>(order.size(), 10);
+    std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(shown), order.end(),
+                      [&](std::size_t const a, std::size_t const b) { return counts[a] > counts[b]; });
+    os << "Hottest commands:\n";
+    for (auto const pc : std::span{ order }.first(shown)) {
+        if (counts[pc] == 0) break;
+        os << std::setw(14) << counts[pc] << "  " << describeSpan(source, program.sourceMap[pc]) << '\n';
+    }
+}
+
+/* --loops: per `[`, how many times the loop was reached and how many iterations each time ran.
+ * Every iteration starts with the `[` test (`]` always jumps back to it), so a `[` whose loop is
+ * on top of the stack continues it, and any other `[` is a fresh entry. */
+class LoopStats {
+public:
+    struct Loop {
+        std::uint64_t entries = 0;
+        std::uint64_t iterations = 0;
+        std::array<std::uint64_t, 65> trips{}; /* Entries by `std::bit_width(iterations)`: 0, 1, 2-3, 4-7, ... */
+    };
+
+    explicit LoopStats(Program const& program) : program_{ &program } {}
+
+    void command(std::size_t const pc, Pointer const& p) {
+        if (program_->code[pc] != Command::LoopBegin) return;
+        auto const continuing = not active_.empty() and active_.back().first == pc;
+        if (*p != 0) {
+            if (continuing) ++active_.back().second;
+            else active_.emplace_back(pc, 1);
+        }
+        else if (continuing) {
+            record(pc, active_.back().second);
+            active_.pop_back();
+        }
+        else record(pc, 0);
+    }
+
+    /* Loops still running when the program stopped count as if they ended there */
+    [[nodiscard]] auto loops() -> std::map<std::size_t, Loop> const& {
+        for (; not active_.empty(); active_.pop_back()) record(active_.back().first, active_.back().second);
+        return loops_;
+    }
+
+private:
+    void record(std::size_t const pc, std::uint64_t const iterations) {
+        auto& loop = loops_[pc];
+        ++loop.entries;
+        loop.iterations += iterations;
+        ++loop.trips[static_cast<std::size_t>(std::bit_width(iterations))];
+    }
+
+    Program const* program_;
+    std::vector<std::pair<std::size_t, std::uint64_t>> active_; /* (`[`, iterations so far), innermost last */
+    std::map<std::size_t, Loop> loops_;                          /* By the pc of `[` */
+};
+
+/* The idiom a loop body matches but the optimizer left as a loop, or nullptr. Only innermost
+ * loops without I/O qualify: "scan" moves the pointer and nothing else (`[>]`), "clear" only
+ * changes the tested cell (`[--]` is not folded: an even step can miss zero), "multiply" adds
+ * multiples of the tested cell elsewhere and steps it by one (`[->+<]`). */
+[[nodiscard]] auto missedIdiom(Program const& program, std::size_t const begin) -> char const* {
+    auto const& code = program.code;
+    std::ptrdiff_t offset = 0;
+    unsigned char step = 0; /* Change to the tested cell per iteration */
+    bool touchesOthers = false, changesCells = false;
+    auto pc = begin + 1;
+    for (; code[pc] != Command::LoopEnd; ++pc) {
+        auto const com = code[pc];
+        auto const count = static_cast<std::ptrdiff_t>(com.count());
+        switch (com.command()) {
+            case Command::PointerIncr: offset += count; break;
+            case Command::PointerDecr: offset -= count; break;
+            case Command::CellValIncr:
+            case Command::CellValDecr:
+                changesCells = true;
+                if (offset != 0) touchesOthers = true;
+                else if (com == Command::CellValIncr) operation<'+'>(step, com.count());
+                else operation<'-'>(step, com.count());
+                break;
+            case Command::CellClear:
+                changesCells = true;
+                if (offset == 0) return nullptr; /* Runs at most once */
+                touchesOthers = true;
+                break;
+            default:
+                return nullptr; /* I/O or a nested loop */
+        }
+    }
+    if (not changesCells) return offset != 0 ? "scan" : nullptr;
+    if (offset != 0) return nullptr;
+    if (not touchesOthers) return step % 2 == 0 ? nullptr : "clear";
+    return step == 1 or step == 255 ? "multiply" : nullptr;
+}
+
+/* Loops ranked by iterations, with their trip-count histograms and missed idioms */
+void printLoopReport(std::ostream& os, std::string_view const source, Program const& program, LoopStats& stats) {
+    auto const& loops = stats.loops();
+    std::vector<std::pair<std::size_t, LoopStats::Loop const*>> ranked;
+    for (auto const& [pc, loop] : loops) ranked.emplace_back(pc, &loop);
+    std::sort(ranked.begin(), ranked.end(), [](auto const& a, auto const& b) { return a.second->iterations > b.second->iterations; });
+
+    os << "Loops by iterations (" << ranked.size() << " reached):\n"
+       << std::setw(14) << "iterations" << std::setw(12) << "entries" << std::setw(10) << "avg" << "  location / trips per entry\n";
+    for (auto const& [pc, loop] : std::span{ ranked }.first(std::min<std::size_t>(ranked.size(), 20))) {
+        auto const end = static_cast<std::size_t>(skipLoop(program.code.begin() + static_cast<std::ptrdiff_t>(pc)) - program.code.begin());
+        os << std::setw(14) << loop->iterations << std::setw(12) << loop->entries << std::setw(10) << std::setprecision(4)
+           << static_cast<double>(loop->iterations) / static_cast<double>(loop->entries) << "  "
+           << describeSpan(source, { program.sourceMap[pc].begin, program.sourceMap[end].end });
+        if (auto const idiom = missedIdiom(program, pc)) os << "  [not folded: " << idiom << ']';
+        os << "\n" << std::setw(38) << "";
+        for (std::size_t bucket = 0; bucket != loop->trips.size(); ++bucket) {
+            if (loop->trips[bucket] == 0) continue;
+            if (bucket < 2) os << ' ' << bucket;
+            else os << ' ' << (std::uint64_t{ 1 } << (bucket - 1)) << '-' << (std::uint64_t{ 1 } << (bucket - 1)) * 2 - 1;
+            os << 'x' << loop->trips[bucket];
+        }
+        os << '\n';
+    }
+}
+
+/* --tape-stats: how the program uses the tape. Cells are counted in 4 KiB pages (one byte per
+ * cell); the working set is the number of distinct pages touched per window of commands. */
+class TapeStats {
+public:
+    static constexpr std::size_t pageCells = 4096;
+    static constexpr std::uint64_t window = 1 << 16; /* Commands per working-set window */
+    static constexpr std::size_t maxSamples = 4096; /* Pointer samples kept; the interval doubles to stay under */
+
+    explicit TapeStats(Program const& program) : program_{ &program } {}
+
+    void command(std::size_t const pc, Pointer const& p) {
+        auto const cell = p.index();
+        if (steps_ % sampleInterval_ == 0) {
+            if (samples_.size() == maxSamples) {
+                for (std::size_t i = 0; i != maxSamples / 2; ++i) samples_[i] = samples_[2 * i];
+                samples_.resize(maxSamples / 2);
+                sampleInterval_ *= 2;
+            }
+            if (steps_ % sampleInterval_ == 0) samples_.emplace_back(steps_, cell);
+        }
+        if (steps_ != 0 and steps_ % window == 0) closeWindow();
+        ++steps_;
+
+        switch (program_->code[pc].command()) {
+            case Command::PointerIncr:
+            case Command::PointerDecr:
+                return; /* Moves without touching a cell */
+            default:
+                break;
+        }
+        auto const page = cell / pageCells;
+        if (page >= pages_.size()) pages_.resize(page + 1);
+        auto& entry = pages_[page];
+        ++entry.accesses;
+        if (entry.lastWindow != windows_.size() + 1) {
+            entry.lastWindow = windows_.size() + 1;
+            ++windowPages_;
+        }
+    }
+
+    /* Write <prefix>.pages.csv, <prefix>.pointer.csv and <prefix>.working-set.csv and print a summary */
+    void report(std::ostream& os, std::string const& prefix) {
+        /* The current window holds whatever came after the closed ones (at least one window, even for no commands) */
+        if (steps_ > windows_.size() * window or windows_.empty()) closeWindow();
+        std::ofstream pages{ prefix + ".pages.csv" }, pointer{ prefix + ".pointer.csv" }, workingSet{ prefix + ".working-set.csv" };
+        if (not pages or not pointer or not workingSet) throw std::runtime_error("Can't write the tape statistics to " + prefix + ".*.csv");
+
+        pages << "page,first_cell,accesses\n";
+        std::size_t touched = 0;
+        for (std::size_t page = 0; page != pages_.size(); ++page) {
+            pages << page << ',' << page * pageCells << ',' << pages_[page].accesses << '\n';
+            if (pages_[page].accesses != 0) ++touched;
+        }
+        pointer << "step,cell\n";
+        for (auto const& [step, cell] : samples_) pointer << step << ',' << cell << '\n';
+        workingSet << "window_start,pages\n";
+        for (std::size_t i = 0; i != windows_.size(); ++i) workingSet << i * window << ',' << windows_[i] << '\n';
+
+        auto const peak = *std::max_element(windows_.begin(), windows_.end());
+        auto const average = static_cast<double>(std::accumulate(windows_.begin(), windows_.end(), std::uint64_t{ 0 })) / static_cast<double>(windows_.size());
+        os << "Tape: " << touched << " of " << pages_.size() << " pages touched (" << pageCells << " cells each), working set per "
+           << window << " commands: peak " << peak << " pages, average " << std::setprecision(3) << average << '\n';
+    }
+
+private:
+    struct Page {
+        std::uint64_t accesses = 0;
+        std::size_t lastWindow = 0; /* 1 + the window it was last counted in */
+    };
+
+    void closeWindow() {
+        windows_.push_back(windowPages_);
+        windowPages_ = 0;
+    }
+
+    Program const* program_;
+    std::uint64_t steps_ = 0;
+    std::uint64_t sampleInterval_ = 1;
+    std::vector<std::pair<std::uint64_t, std::size_t>> samples_; /* (step, cell) */
+    std::vector<Page> pages_;
+    std::vector<std::uint64_t> windows_; /* Pages touched in each finished window */
+    std::uint64_t windowPages_ = 0;
+};
+
+/* --sample: a SIGPROF-driven sampling profiler. The interpreter publishes the pc through its
+ * probe (one relaxed store per command); under --jit the handler takes the interrupted
+ * instruction address instead. Both are mapped back to commands after the run, and since loops
+ * nest lexically the enclosing loops follow from the pc alone. */
+class SamplingProfiler {
+public:
+    static constexpr std::size_t capacity = std::size_t{ 1 } << 20; /* Samples kept; later ones are dropped */
+
+    struct Probe {
+        SamplingProfiler* profiler;
+        void command(std::size_t const pc, Pointer const&) noexcept { profiler->pc_.store(pc, std::memory_order_relaxed); }
+    };
+
+    explicit SamplingProfiler(bool const jit) : jit_{ jit }, samples_(capacity) {}
+    SamplingProfiler(SamplingProfiler const&) = delete;
+    auto operator=(SamplingProfiler const&) -> SamplingProfiler& = delete;
+    ~SamplingProfiler() { stop(); }
+
+    [[nodiscard]] auto probe() noexcept -> Probe { return { this }; }
+
+    void start(unsigned const hertz) {
+        active_.store(this);
+        struct sigaction action{};
+        action.sa_sigaction = &onSignal;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        ::sigaction(SIGPROF, &action, nullptr);
+        itimerval timer{};
+        timer.it_interval.tv_usec = static_cast<suseconds_t>(1'000'000 / std::max(hertz, 1u));
+        timer.it_value = timer.it_interval;
+        ::setitimer(ITIMER_PROF, &timer, nullptr);
+    }
+
+    void stop() noexcept {
+        if (active_.load() != this) return;
+        itimerval const timer{};
+        ::setitimer(ITIMER_PROF, &timer, nullptr);
+        ::signal(SIGPROF, SIG_IGN);
+        active_.store(nullptr);
+    }
+
+    /* Interpreter pcs, or instruction addresses under --jit; SIZE_MAX before the first command */
+    [[nodiscard]] auto samples() const noexcept -> std::span<std::uintptr_t const> {
+        return std::span{ samples_ }.first(std::min(taken_.load(), capacity));
+    }
+    [[nodiscard]] auto dropped() const noexcept -> std::size_t { return taken_.load() - samples().size(); }
+    [[nodiscard]] auto jit() const noexcept -> bool { return jit_; }
+
+private:
+    static void onSignal(int, siginfo_t*, void* const context) noexcept {
+        auto* const self = active_.load(std::memory_order_relaxed);
+        if (self == nullptr) return;
+        std::uintptr_t sample = self->pc_.load(std::memory_order_relaxed);
+#if defined(__linux__) && defined(__x86_64__)
+        if (self->jit_) sample = static_cast<std::uintptr_t>(static_cast<ucontext_t*>(context)->uc_mcontext.gregs[REG_RIP]);
+#else
+        (void)context;
+#endif // __linux__ && __x86_64__
+        auto const index = self->taken_.fetch_add(1, std::memory_order_relaxed);
+        if (index < capacity) self->samples_[index] = sample;
+    }
+
+    static inline std::atomic<SamplingProfiler*> active_{ nullptr };
+
+    bool jit_;
+    std::atomic<std::size_t> pc_{ SIZE_MAX };
+    std::vector<std::uintptr_t> samples_;
+    std::atomic<std::size_t> taken_{ 0 };
+};
+
+/* Write the samples as folded stacks ("program;loop;loop;command count"), one line per distinct
+ * stack, ready for flamegraph.pl and compatible tools. `commandAt` maps a sample to its pc;
+ * samples it can't place (JIT I/O helpers, the kernel) are charged to "[runtime]". */
+void writeFoldedStacks(std::ostream& os, std::span<std::uintptr_t const> const samples, std::string_view const source,
+                       Program const& program, char const* const sourcePath,
+                       std::function<std::optional<std::size_t>(std::uintptr_t)> const& commandAt) {
+    auto const& code = program.code;
+    std::vector<std::size_t> enclosing(code.size(), SIZE_MAX); /* Innermost `[` around each command; a loop's own brackets count */
+    std::vector<std::size_t> outer(code.size(), SIZE_MAX);     /* Per `[`: the `[` of the loop around it */
+    std::vector<std::size_t> open;
+    for (std::size_t pc = 0; pc != code.size(); ++pc) {
+        if (code[pc] == Command::LoopBegin) {
+            if (not open.empty()) outer[pc] = open.back();
+            open.push_back(pc);
+        }
+        if (not open.empty()) enclosing[pc] = open.back();
+        if (code[pc] == Command::LoopEnd) open.pop_back();
+    }
+
+    std::map<std::string, std::size_t> stacks;
+    for (auto const sample : samples) {
+        std::string stack = sourcePath;
+        if (auto const pc = commandAt(sample)) {
+            std::vector<std::string> frames;
+            for (auto loop = enclosing[*pc]; loop != SIZE_MAX; loop = outer[loop]) {
+                auto const end = static_cast<std::size_t>(skipLoop(code.begin() + static_cast<std::ptrdiff_t>(loop)) - code.begin());
+                frames.push_back(describeSpan(source, { program.sourceMap[loop].begin, program.sourceMap[end].end }));
+            }
+            for (auto frame = frames.rbegin(); frame != frames.rend(); ++frame) stack += ';' + *frame;
+            stack += ';' + describeSpan(source, program.sourceMap[*pc]);
+        }
+        else stack += ";[runtime]";
+        ++stacks[stack];
+    }
+    for (auto const& [stack, count] : stacks) os << stack << ' ' << count << '\n';
+}
+
+/* The probe for instrumented runs: whichever reports were asked for. Branching on them costs only
+ * this instantiation; the plain engine uses `NoProbe`. */
+struct Instruments {
+    std::optional<ExecutionCounts> counts;
+    std::optional<LoopStats> loops;
+    std::optional<TapeStats> tape;
+    SamplingProfiler* sampler = nullptr; /* Only here when combined with another report */
+
+    [[nodiscard]] auto any() const noexcept -> bool { return counts or loops or tape; }
+
+    void command(std::size_t const pc, Pointer const& p) {
+        if (counts) counts->command(pc, p);
+        if (loops) loops->command(pc, p);
+        if (tape) tape->command(pc, p);
+        if (sampler) sampler->probe().command(pc, p);
+    }
+};
+
+/* Why a run stopped early, or nullptr if it finished */
+[[nodiscard]] auto describeStop(Machine::Status const status) noexcept -> char const* {
+    switch (status) {
+        case Machine::Status::StepLimit: return "step-limit";
+        case Machine::Status::Interrupted: return "timeout";
+        default: return nullptr;
+    }
+}
+
+#ifdef BF_HAVE_JIT
+/* Native x86-64 code for a program (--jit). The tape is a flat mapping, so moving the pointer costs
+ * an add and a compare against its bounds, which stay in registers. I/O, and leaving the tape, go
+ * through helper calls that return non-zero after storing an exception, which the generated code
+ * passes straight out: nothing may unwind through frames that have no unwind info. No step budgets
+ * or probes. */
+class JitProgram {
+public:
+    static constexpr std::size_t tapeBytes = std::size_t{ 1 } << 30; /* Reserved, populated on touch */
+
+    /* Straight-line code between loop boundaries, attributed to its innermost loop */
+    struct Region {
+        std::size_t offset;
+        std::size_t size;
+        std::size_t loop; /* pc of the enclosing `[`, or SIZE_MAX for top-level code */
+    };
+
+    explicit JitProgram(Program const& program) : program_{ &program } {
+        startRegion(SIZE_MAX);
+        emit({ 0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x55 }); /* push rbx; push r12; push r13; push r14; push rbp (realigns the stack) */
+        emit({ 0x48, 0x89, 0xFB, 0x49, 0x89, 0xF4 });             /* mov rbx, rdi (cell); mov r12, rsi (context) */
+        emit({ 0x49, 0x89, 0xD5, 0x49, 0x89, 0xCE });             /* mov r13, rdx (first cell); mov r14, rcx (past the last) */
+        std::vector<std::pair<std::size_t, std::size_t>> loops; /* (pc of `[`, offset of its exit jump) */
+        std::vector<std::size_t> leftExits, rightExits;         /* rel32 operands to patch to the stubs below */
+        auto const& code = program.code;
+        for (std::size_t pc = 0; pc != code.size(); ++pc) {
+            auto const com = code[pc];
+            auto const count = com.count();
+            commandOffsets_.push_back(code_.size());
+            switch (com.command()) {
+                case Command::PointerIncr:
+                case Command::PointerDecr:
+                    for (auto left = count; left != 0;) {
+                        auto const step = std::min<std::size_t>(left, INT32_MAX);
+                        emit({ 0x48, 0x81, com == Command::PointerIncr ? std::uint8_t{ 0xC3 } : std::uint8_t{ 0xEB } }); /* add/sub rbx, imm32 */
+                        emitValue(static_cast<std::uint32_t>(step));
+                        left -= step;
+                    }
+                    if (com == Command::PointerIncr) {
+                        emit({ 0x4C, 0x39, 0xF3, 0x0F, 0x83 }); /* cmp rbx, r14; jae <right of the tape> */
+                        rightExits.push_back(code_.size());
+                    }
+                    else {
+                        emit({ 0x4C, 0x39, 0xEB, 0x0F, 0x82 }); /* cmp rbx, r13; jb <left of the tape> */
+                        leftExits.push_back(code_.size());
+                    }
+                    emitValue(std::uint32_t{ 0 });
+                    break;
+                case Command::CellValIncr: emit({ 0x80, 0x03, static_cast<std::uint8_t>(count) }); break; /* add byte [rbx], imm8 */
+                case Command::CellValDecr: emit({ 0x80, 0x2B, static_cast<std::uint8_t>(count) }); break; /* sub byte [rbx], imm8 */
+                case Command::CellClear: emit({ 0xC6, 0x03, 0x00 }); break;                              /* mov byte [rbx], 0 */
+                case Command::Cout: emitCall(&put, count); break;
+                case Command::Cin: emitCall(&get, count); break;
+                case Command::WriteLiteral: emitCall(&writeLiteral, count); break;
+                case Command::LoopBegin:
+                    startRegion(pc);
+                    emit({ 0x80, 0x3B, 0x00, 0x0F, 0x84 }); /* cmp byte [rbx], 0; je <after the loop> */
+                    loops.emplace_back(pc, code_.size());
+                    emitValue(std::uint32_t{ 0 });
+                    break;
+                case Command::LoopEnd: {
+                    auto const exitJump = loops.back().second;
+                    loops.pop_back();
+                    emit({ 0x80, 0x3B, 0x00, 0x0F, 0x85 }); /* cmp byte [rbx], 0; jne <loop body> */
+                    emitValue(static_cast<std::uint32_t>(exitJump + 4 - (code_.size() + 4)));
+                    patch(exitJump, code_.size());
+                    startRegion(loops.empty() ? SIZE_MAX : loops.back().first);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        commandOffsets_.push_back(code_.size());
+        emit({ 0x31, 0xC0 }); /* xor eax, eax */
+        auto const epilogue = code_.size();
+        emit({ 0x5D, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B, 0xC3 }); /* pop rbp; pop r14; pop r13; pop r12; pop rbx; ret */
+        for (auto const jump : leftExits) patch(jump, code_.size());
+        emitCall(&leftOfTape, 0);
+        for (auto const jump : rightExits) patch(jump, code_.size());
+        emitCall(&rightOfTape, 0);
+        for (auto const jump : errorExits_) patch(jump, epilogue);
+        regions_.back().size = code_.size() - regions_.back().offset;
+        std::erase_if(regions_, [](Region const& region) { return region.size == 0; });
+
+        auto const size = code_.size();
+        auto* const addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) throwErrno("mmap");
+        std::memcpy(addr, code_.data(), size);
+        if (::mprotect(addr, size, PROT_READ | PROT_EXEC) != 0) {
+            ::munmap(addr, size);
+            throwErrno("mprotect");
+        }
+        entry_ = static_cast<std::uint8_t*>(addr);
+    }
+
+    JitProgram(JitProgram const&) = delete;
+    auto operator=(JitProgram const&) -> JitProgram& = delete;
+    ~JitProgram() { ::munmap(entry_, code_.size()); }
+
+    [[nodiscard]] auto code() const noexcept -> std::span<std::uint8_t const> { return { entry_, code_.size() }; }
+    [[nodiscard]] auto regions() const noexcept -> std::span<Region const> { return regions_; }
+
+    /* The command whose code contains `address`, if any */
+    [[nodiscard]] auto commandAt(std::uintptr_t const address) const noexcept -> std::optional<std::size_t> {
+        auto const base = reinterpret_cast<std::uintptr_t>(entry_);
+        if (address < base or address >= base + code_.size()) return std::nullopt;
+        auto const after = std::upper_bound(commandOffsets_.begin(), commandOffsets_.end(), address - base);
+        auto const pc = static_cast<std::size_t>(after - commandOffsets_.begin());
+        if (pc == 0 or pc == commandOffsets_.size()) return std::nullopt; /* Prologue, epilogue or error stubs */
+        return pc - 1;
+    }
+
+    /* Run on a fresh tape; with `tapeHash`, hash the final tape the way `hashTape` does */
+    void run(Output& out, Input& in, std::uint64_t* const tapeHash = nullptr) const {
+        auto const page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        auto const mapped = tapeBytes + 2 * page;
+        auto* const tape = static_cast<char*>(::mmap(nullptr, mapped, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+        if (tape == MAP_FAILED) throwErrno("mmap");
+        struct Unmap {
+            std::size_t size;
+            void operator()(char* const p) const noexcept { ::munmap(p, size); }
+        };
+        std::unique_ptr<char, Unmap> const owner{ tape, Unmap{ mapped } };
+        if (::mprotect(tape + page, tapeBytes, PROT_READ | PROT_WRITE) != 0) throwErrno("mprotect");
+
+        Context context{ &out, &in, program_, {} };
+        auto const function = reinterpret_cast<int (*)(char*, Context*, char*, char*)>(entry_);
+        if (function(tape + page, &context, tape + page, tape + page + tapeBytes) != 0) std::rethrow_exception(context.error);
+        if (tapeHash != nullptr) *tapeHash = hashTouchedCells(tape + page, page);
+    }
+
+private:
+    struct Context {
+        Output* out;
+        Input* in;
+        Program const* program;
+        std::exception_ptr error;
+    };
+    using Helper = int (*)(Context*, char*, std::size_t) noexcept;
+
+    /* Pages the program never touched aren't resident and hold only zeros */
+    [[nodiscard]] static auto hashTouchedCells(char* const tape, std::size_t const page) -> std::uint64_t {
+        std::vector<unsigned char> resident(tapeBytes / page);
+        if (::mincore(tape, tapeBytes, resident.data()) != 0) throwErrno("mincore");
+        TapeHasher hasher;
+        for (std::size_t i = 0; i != resident.size(); ++i)
+            if (resident[i] & 1)
+                for (auto cell = i * page; cell != (i + 1) * page; ++cell) hasher.add(cell, tape[cell]);
+        return hasher.value();
+    }
+
+    template <typename F>
+    static auto guarded(Context* const context, F const f) noexcept -> int {
+        try {
+            f();
+            return 0;
+        }
+        catch (...) {
+            context->error = std::current_exception();
+            return 1;
+        }
+    }
+    static auto put(Context* const context, char* const cell, std::size_t const count) noexcept -> int {
+        return guarded(context, [&] { context->out->put(*cell, count); });
+    }
+    static auto get(Context* const context, char* const cell, std::size_t const count) noexcept -> int {
+        return guarded(context, [&] { for (std::size_t i = 0; i != count and context->in->get(*cell); ++i) {} });
+    }
+    static auto writeLiteral(Context* const context, char*, std::size_t const index) noexcept -> int {
+        return guarded(context, [&] { context->out->write(context->program->literal(index)); });
+    }
+    static auto leftOfTape(Context* const context, char*, std::size_t) noexcept -> int {
+        return guarded(context, [] { throw Pointer::leftOfTape(); });
+    }
+    static auto rightOfTape(Context* const context, char*, std::size_t) noexcept -> int {
+        return guarded(context, [] { throw std::out_of_range{ "Pointer moved past the JIT's " + std::to_string(tapeBytes >> 30) + " GiB tape" }; });
+    }
+
+    void emit(std::initializer_list<std::uint8_t> const bytes) { code_.insert(code_.end(), bytes); }
+
+    template <typename T>
+    void emitValue(T const value) {
+        std::uint8_t bytes[sizeof value];
+        std::memcpy(bytes, &value, sizeof value);
+        code_.insert(code_.end(), std::begin(bytes), std::end(bytes));
+    }
+
+    /* Point the rel32 at `at` to `target` */
+    void patch(std::size_t const at, std::size_t const target) {
+        auto const rel = static_cast<std::uint32_t>(target - (at + 4));
+        std::memcpy(code_.data() + at, &rel, sizeof rel);
+    }
+
+    /* helper(context, cell, argument); leave through the epilogue if it fails */
+    void emitCall(Helper const helper, std::size_t const argument) {
+        emit({ 0x4C, 0x89, 0xE7, 0x48, 0x89, 0xDE, 0x48, 0xBA }); /* mov rdi, r12; mov rsi, rbx; mov rdx, imm64 */
+        emitValue(static_cast<std::uint64_t>(argument));
+        emit({ 0x48, 0xB8 }); /* mov rax, imm64 */
+        emitValue(reinterpret_cast<std::uint64_t>(helper));
+        emit({ 0xFF, 0xD0, 0x85, 0xC0, 0x0F, 0x85 }); /* call rax; test eax, eax; jnz <epilogue> */
+        errorExits_.push_back(code_.size());
+        emitValue(std::uint32_t{ 0 });
+    }
+
+    void startRegion(std::size_t const loop) {
+        if (not regions_.empty()) regions_.back().size = code_.size() - regions_.back().offset;
+        regions_.push_back({ code_.size(), 0, loop });
+    }
+
+    Program const* program_;
+    std::vector<std::uint8_t> code_;
+    std::vector<std::size_t> errorExits_; /* rel32 operands to patch to the epilogue */
+    std::vector<Region> regions_;
+    std::vector<std::size_t> commandOffsets_; /* Per command, where its code starts; then the epilogue */
+    std::uint8_t* entry_ = nullptr;
+};
+
+/* The symbol perf shows for a region: the loop's source position and text, or the top level */
+[[nodiscard]] auto regionName(std::string_view const source, Program const& program, char const* const sourcePath,
+                              std::size_t const loop) -> std::string {
+    if (loop == SIZE_MAX) return std::string{ "bf:" } + sourcePath + ":top-level";
+    auto const end = static_cast<std::size_t>(skipLoop(program.code.begin() + static_cast<std::ptrdiff_t>(loop)) - program.code.begin());
+    return std::string{ "bf:" } + sourcePath + ':' + describeSpan(source, { program.sourceMap[loop].begin, program.sourceMap[end].end });
+}
+
+/* Append every region to /tmp/perf-<pid>.map, which `perf report` reads for anonymous executable memory */
+void writePerfMap(JitProgram const& jit, std::string_view const source, Program const& program, char const* const sourcePath) {
+    std::ofstream map{ "/tmp/perf-" + std::to_string(::getpid()) + ".map", std::ios::app };
+    auto const base = reinterpret_cast<std::uintptr_t>(jit.code().data());
+    for (auto const& region : jit.regions())
+        map << std::hex << base + region.offset << ' ' << region.size << std::dec << ' '
+            << regionName(source, program, sourcePath, region.loop) << '\n';
+}
+
+/* Write jit-<pid>.dump in the current directory, one JIT_CODE_LOAD record per region. The file
+ * stays mapped executable so `perf record -k mono` notes it and `perf inject --jit` can find it. */
+void writeJitDump(JitProgram const& jit, std::string_view const source, Program const& program, char const* const sourcePath) {
+    auto const timestamp = [] {
+        timespec ts{};
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000 + static_cast<std::uint64_t>(ts.tv_nsec);
+    };
+    auto const path = "jit-" + std::to_string(::getpid()) + ".dump";
+    UniqueFd const fd{ ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666) };
+    if (not fd) throwErrno("open jitdump");
+
+    std::string dump;
+    auto const append = [&](auto const value) { dump.append(reinterpret_cast<char const*>(&value), sizeof value); };
+    append(std::uint32_t{ 0x4A695444 }); /* Magic "JiTD" */
+    append(std::uint32_t{ 1 });          /* Version */
+    append(std::uint32_t{ 40 });         /* Header size */
+    append(std::uint32_t{ 62 });         /* EM_X86_64 */
+    append(std::uint32_t{ 0 });
+    append(static_cast<std::uint32_t>(::getpid()));
+    append(timestamp());
+    append(std::uint64_t{ 0 }); /* Flags */
+
+    auto const base = reinterpret_cast<std::uintptr_t>(jit.code().data());
+    std::uint64_t index = 0;
+    for (auto const& region : jit.regions()) {
+        auto const name = regionName(source, program, sourcePath, region.loop);
+        append(std::uint32_t{ 0 }); /* JIT_CODE_LOAD */
+        append(static_cast<std::uint32_t>(16 + 40 + name.size() + 1 + region.size));
+        append(timestamp());
+        append(static_cast<std::uint32_t>(::getpid()));
+        append(static_cast<std::uint32_t>(::gettid()));
+        append(static_cast<std::uint64_t>(base + region.offset)); /* vma */
+        append(static_cast<std::uint64_t>(base + region.offset)); /* code address */
+        append(static_cast<std::uint64_t>(region.size));
+        append(index++);
+        dump.append(name.c_str(), name.size() + 1);
+        dump.append(reinterpret_cast<char const*>(jit.code().data() + region.offset), region.size);
+    }
+    writeAll(fd.get(), dump.data(), dump.size());
+    /* Deliberately never unmapped: the mapping is the marker perf looks for */
+    if (::mmap(nullptr, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)), PROT_READ | PROT_EXEC, MAP_PRIVATE, fd.get(), 0) == MAP_FAILED)
+        throwErrno("mmap jitdump");
+}
+#endif // BF_HAVE_JIT
+
+/* --metrics=json: one record per execution, as a line of JSON. Unknown values are null. */
+struct RunMetrics {
+    std::optional<std::size_t> job; /* Index in --batch/--inputs */
+    char const* engine = "interpreter";
+    int optimizationLevel = 1;
+    char const* status = "ok";
+    std::optional<double> parseSeconds;
+    std::optional<double> optimizeSeconds;
+    double executeSeconds = 0;
+    std::optional<std::size_t> sourceBytes;
+    std::optional<std::size_t> parsedCommands;
+    std::optional<std::size_t> compiledCommands;
+    std::optional<std::uint64_t> steps;
+    std::optional<std::size_t> tapeCells;
+    std::size_t bytesIn = 0;
+    std::size_t bytesOut = 0;
+    std::optional<bool> cacheHit; /* Null without --result-cache */
+};
+
+[[nodiscard]] auto toJson(RunMetrics const& m) -> std::string {
+    std::ostringstream json;
+    json << std::setprecision(9);
+    auto const field = [&](char const* const name, auto const& value) {
+        json << (json.tellp() == 0 ? "{" : ",") << '"' << name << "\":";
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, char const*>) json << '"' << value << '"';
+        else if constexpr (std::is_same_v<T, bool>) json << (value ? "true" : "false");
+        else if constexpr (requires { value.has_value(); }) {
+            if (not value) json << "null";
+            else if constexpr (std::is_same_v<typename T::value_type, bool>) json << (*value ? "true" : "false");
+            else json << *value;
+        }
+        else json << value;
+    };
+    if (m.job) field("job", *m.job);
+    field("engine", m.engine);
+    field("optimization_level", m.optimizationLevel);
+    field("status", m.status);
+    field("parse_seconds", m.parseSeconds);
+    field("optimize_seconds", m.optimizeSeconds);
+    field("execute_seconds", m.executeSeconds);
+    field("source_bytes", m.sourceBytes);
+    field("commands_parsed", m.parsedCommands);
+    field("commands_optimized", m.compiledCommands);
+    field("commands_executed", m.steps);
+    field("peak_tape_cells", m.tapeCells);
+    field("bytes_in", m.bytesIn);
+    field("bytes_out", m.bytesOut);
+    field("cache_hit", m.cacheHit);
+    json << "}\n";
+    return json.str();
+}
+
+/* A non-negative decimal that fills all of `text`, or nothing */
+[[nodiscard]] auto parseCount(std::string_view const text) -> std::optional<int> {
+    int value = 0;
+    auto const [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} or end != text.data() + text.size() or value < 0) return std::nullopt;
+    return value;
+}
+
+/* Where the records go: a file we own or a descriptor we were handed (`fd:<n>`). Thread safe. */
+class MetricsSink {
+public:
+    /* Returns nullptr (after saying why) if `target` can't be opened */
+    [[nodiscard]] static auto open(char const* const target) -> std::unique_ptr<MetricsSink> {
+        std::string_view const name = target;
+        if (name.starts_with("fd:")) {
+            auto const fd = parseCount(name.substr(3));
+            if (not fd) {
+                std::cerr << "Bad metrics descriptor " << target << '\n';
+                return nullptr;
+            }
+            return std::unique_ptr<MetricsSink>{ new MetricsSink(*fd, UniqueFd{}) };
+        }
+        UniqueFd file{ ::open(target, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666) };
+        if (not file) {
+            std::cerr << "Can't open the metrics file " << target << '\n';
+            return nullptr;
+        }
+        auto const fd = file.get();
+        return std::unique_ptr<MetricsSink>{ new MetricsSink(fd, std::move(file)) };
+    }
+
+    void write(RunMetrics const& metrics) {
+        auto const line = toJson(metrics);
+        std::lock_guard const lock{ mutex_ };
+        writeAll(fd_, line.data(), line.size());
+    }
+
+private:
+    MetricsSink(int const fd, UniqueFd owned) noexcept : fd_{ fd }, owned_{ std::move(owned) } {}
+
+    int fd_;
+    UniqueFd owned_;
+    std::mutex mutex_;
+};
+
+/* The compile-time half of a record */
+void describeCompile(RunMetrics& metrics, Program const& program, PerfCounters const* const phases, int const optimizationLevel) {
+    metrics.optimizationLevel = optimizationLevel;
+    metrics.sourceBytes = program.sourceBytes;
+    metrics.parsedCommands = program.parsedCommands;
+    metrics.compiledCommands = program.code.size();
+    if (phases != nullptr) {
+        metrics.parseSeconds = phases->seconds("parse");
+        metrics.optimizeSeconds = phases->seconds("optimize");
+    }
+}
+
+/* --trace: everything needed to replay a run exactly. The only nondeterminism is input, so the
+ * trace holds the input bytes as they are read plus machine checkpoints taken every so many
+ * steps. Checkpoints come from the step limit the engine already checks, so tracing costs
+ * nothing between them.
+ *
+ * Format, numbers as LEB128 varints: "BFTRACE1", fingerprint (u64), then records:
+ *   'I' size bytes                              input as the program read it
+ *   'C' steps pc charged index input output depth loops... size tape
+ *                                               checkpoint; trailing zero cells are dropped
+ *   'E' status steps                            end of the run */
+namespace trace {
+constexpr std::string_view magic = "BFTRACE1";
+
+class Writer {
+public:
+    Writer(char const* const path, std::uint64_t const fingerprint) : file_{ path, std::ios::binary | std::ios::trunc } {
+        if (not file_) throw std::runtime_error(std::string{ "Can't write the trace " } + path);
+        file_.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+        file_.write(reinterpret_cast<char const*>(&fingerprint), sizeof fingerprint);
+    }
+
+    void input(std::span<char const> const bytes) {
+        if (bytes.empty()) return;
+        file_.put('I');
+        number(bytes.size());
+        file_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    void checkpoint(Machine const& machine, std::size_t const inputPos, std::size_t const outputPos) {
+        auto const snapshot = machine.snapshot();
+        file_.put('C');
+        for (auto const value : { machine.steps(), snapshot.pc, snapshot.charged, snapshot.index, inputPos, outputPos, snapshot.loops.size() })
+            number(value);
+        for (auto const loop : snapshot.loops) number(loop);
+        auto used = snapshot.tape.size();
+        while (used > 0 and snapshot.tape[used - 1] == 0) --used;
+        number(used);
+        for (std::size_t i = 0; i != used; ++i) file_.put(snapshot.tape[i]);
+    }
+
+    void end(Execution const& run) {
+        file_.put('E');
+        number(static_cast<std::uint64_t>(run.status));
+        number(run.steps);
+        file_.flush();
+        if (not file_) throw std::runtime_error("Writing the trace failed");
+    }
+
+private:
+    void number(std::uint64_t value) {
+        do {
+            auto const byte = static_cast<char>((value & 0x7f) | (value > 0x7f ? 0x80 : 0));
+            file_.put(byte);
+            value >>= 7;
+        } while (value != 0);
+    }
+
+    std::ofstream file_;
+};
+
+/* Passes input through, recording each chunk as the program's `,` pulls it in */
+class RecordingInput final : public InputBackend {
+public:
+    RecordingInput(InputBackend& source, Writer& writer) noexcept : source_{ &source }, writer_{ &writer } {}
+
+    auto refill() -> std::span<char const> override {
+        auto const chunk = source_->refill();
+        writer_->input(chunk);
+        return chunk;
+    }
+    auto ready() -> bool override { return source_->ready(); }
+
+private:
+    InputBackend* source_;
+    Writer* writer_;
+};
+
+struct Checkpoint {
+    std::uint64_t steps;
+    std::size_t inputPos;  /* Input bytes consumed */
+    std::size_t outputPos; /* Output bytes written */
+    Machine::Snapshot machine;
+};
+
+struct Trace {
+    std::uint64_t fingerprint = 0;
+    std::string input;
+    std::vector<Checkpoint> checkpoints; /* By step */
+    std::optional<Execution> end;        /* Missing if the traced run crashed */
+
+    /* The last checkpoint at or before `step`, by bisection */
+    [[nodiscard]] auto before(std::uint64_t const step) const -> Checkpoint const& {
+        auto const after = std::upper_bound(checkpoints.begin(), checkpoints.end(), step,
+                                            [](std::uint64_t const s, Checkpoint const& c) { return s < c.steps; });
+        return *std::prev(after);
+    }
+};
+
+[[nodiscard]] auto read(char const* const path) -> Trace {
+    auto const bytes = readWholeFile(path);
+    if (not bytes or not bytes->starts_with(magic) or bytes->size() < magic.size() + 8)
+        throw std::runtime_error(std::string{ "Not a trace: " } + path);
+    std::string_view rest{ *bytes };
+    rest.remove_prefix(magic.size());
+    Trace trace;
+    std::memcpy(&trace.fingerprint, rest.data(), sizeof trace.fingerprint);
+    rest.remove_prefix(sizeof trace.fingerprint);
+
+    auto const truncated = [] { return std::runtime_error("Truncated trace"); };
+    auto const number = [&] {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            if (rest.empty() or shift > 63) throw truncated();
+            auto const byte = static_cast<unsigned char>(rest.front());
+            rest.remove_prefix(1);
+            value |= std::uint64_t{ byte & 0x7fu } << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+    };
+    auto const take = [&](std::size_t const size) {
+        if (rest.size() < size) throw truncated();
+        auto const taken = rest.substr(0, size);
+        rest.remove_prefix(size);
+        return taken;
+    };
+    while (not rest.empty()) {
+        auto const type = take(1).front();
+        if (type == 'I') trace.input += take(number());
+        else if (type == 'C') {
+            Checkpoint checkpoint{};
+            checkpoint.steps = number();
+            checkpoint.machine.pc = number();
+            checkpoint.machine.charged = number();
+            checkpoint.machine.index = number();
+            checkpoint.inputPos = number();
+            checkpoint.outputPos = number();
+            checkpoint.machine.loops.resize(number());
+            for (auto& loop : checkpoint.machine.loops) loop = number();
+            auto const tape = take(number());
+            checkpoint.machine.tape.assign(tape.begin(), tape.end());
+            trace.checkpoints.push_back(std::move(checkpoint));
+        }
+        else if (type == 'E') {
+            auto const status = static_cast<Machine::Status>(number());
+            trace.end = Execution{ status, number() };
+        }
+        else throw std::runtime_error("Corrupt trace");
+    }
+    if (trace.checkpoints.empty()) throw truncated();
+    return trace;
+}
+} // namespace trace
+
+/* Run like `execute` with a checkpoint every `interval` steps (and one at step 0). `in` should read
+ * through a `trace::RecordingInput` on the same writer. */
+auto executeTraced(Program const& program, Output& out, Input& in, RunLimits const& limits, trace::Writer& writer,
+                   std::uint64_t const interval) -> Execution {
+    Machine machine{ program };
+    writer.checkpoint(machine, 0, 0);
+    auto next = interval;
+    auto stepLimits = limits;
+    for (;;) {
+        stepLimits.maxSteps = std::min<std::uint64_t>(next, limits.maxSteps);
+        auto const status = machine.run<false>(out, in, stepLimits);
+        if (status == Machine::Status::StepLimit and next < limits.maxSteps) {
+            writer.checkpoint(machine, in.bytesRead(), out.bytesWritten());
+            next = machine.steps() + interval;
+            continue;
+        }
+        Execution const run{ status, machine.steps(), machine.tapeCells() };
+        writer.end(run);
+        return run;
+    }
+}
+
+/* Output that goes nowhere, for fast-forwarding a replay */
+class DiscardOutput final : public OutputBackend {
+public:
+    auto flush(std::span<char>) -> std::span<char> override { return buffer_; }
+
+private:
+    std::array<char, 4096> buffer_;
+};
+
+/* --replay: restore the checkpoint before `from`, run silently up to `from`, then write the output
+ * of steps [from, to) to `out` and describe the machine at `to` on `os`. */
+[[nodiscard]] auto replay(char const* const tracePath, Program const& program, std::string_view const source,
+                          std::uint64_t const from, std::uint64_t const to, Output& out, std::ostream& os) -> bool {
+    auto const recorded = trace::read(tracePath);
+    if (recorded.fingerprint != program.fingerprint) {
+        std::cerr << "The trace was recorded with a different program or optimization level\n";
+        return false;
+    }
+    auto const& start = recorded.before(from);
+    Machine machine{ program, start.machine };
+    MemoryInput inputBackend{ std::string_view{ recorded.input }.substr(start.inputPos) };
+    Input in{ inputBackend };
+
+    /* Engine runs stop at check points, at most one pass over the code past the limit; single-step the rest */
+    auto const advance = [&](std::uint64_t const target, Output& sink) {
+        auto const margin = static_cast<std::uint64_t>(program.code.size());
+        if (target > machine.steps() + margin) (void)machine.run<false>(sink, in, RunLimits{ target - margin, nullptr });
+        while (machine.steps() < target and machine.step(sink, in)) {}
+    };
+    DiscardOutput discard;
+    Output skipped{ discard };
+    advance(from, skipped);
+    advance(to, out);
+
+    auto const steps = machine.steps();
+    os << "Step " << steps << " (checkpoint at " << start.steps << ")";
+    if (machine.pc() == program.code.size()) os << ": finished\n";
+    else os << ": next " << describeSpan(source, program.sourceMap[machine.pc()]) << '\n';
+    auto const& tape = machine.tape();
+    auto const first = tape.index() < 8 ? 0 : tape.index() - 8;
+    os << "Pointer at cell " << tape.index() << "; cells " << first << ".." << first + 16 << ':';
+    for (auto cell = first; cell != first + 16; ++cell) {
+        auto const value = cell < tape.cells().size() ? static_cast<unsigned char>(tape.cells()[cell]) : 0;
+        os << (cell == tape.index() ? " [" : " ") << static_cast<unsigned>(value) << (cell == tape.index() ? "]" : "");
+    }
+    os << '\n';
+    if (recorded.end) os << "Traced run ended after " << recorded.end->steps << " steps\n";
+    return true;
+}
+
+/* Run every stage on its own thread, stage N's `.` feeding stage N+1's `,` */
+[[nodiscard]] auto runPipeline(std::vector<Program> const& stages, InputBackend& first, OutputBackend& last,
+                               bool const flushBeforeBlocking, RunLimits const& limits) -> bool {
+    std::vector<std::unique_ptr<SpscRing>> rings;
+    for (std::size_t i = 1; i < stages.size(); ++i) rings.push_back(std::make_unique<SpscRing>());
+
+    std::atomic<bool> failed{ false };
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t i = 0; i != stages.size(); ++i) {
+            threads.emplace_back([&, i] {
+                try {
+                    std::optional<RingInput> ringIn;
+                    std::optional<RingOutput> ringOut;
+                    if (i != 0) ringIn.emplace(*rings[i - 1]);
+                    if (i + 1 != stages.size()) ringOut.emplace(*rings[i]);
+                    Output out{ ringOut ? static_cast<OutputBackend&>(*ringOut) : last };
+                    Input in{ ringIn ? static_cast<InputBackend&>(*ringIn) : first, flushBeforeBlocking ? &out : nullptr };
+                    auto const run = execute(stages[i], out, in, limits);
+                    out.close();
+                    if (auto const stop = describeStop(run.status)) {
+                        std::cerr << "Stage " << i + 1 << " stopped (" << stop << ") after " << run.steps << " instructions\n";
+                        failed = true;
+                    }
+                }
+                catch (std::exception const& e) {
+                    std::cerr << "Stage " << i + 1 << ": " << e.what() << '\n';
+                    failed = true;
+                }
+            });
+        }
+    }
+    return not failed;
+}
+
+struct ResultKey {
+    std::uint64_t program; /* `Program::fingerprint` mixed with the step budget */
+    std::uint64_t input;
+    [[nodiscard]] auto operator==(ResultKey const&) const noexcept -> bool = default;
+};
+
+struct ResultKeyHash {
+    [[nodiscard]] auto operator()(ResultKey const& key) const noexcept -> std::size_t {
+        return static_cast<std::size_t>(key.program ^ (key.input * 0x9e3779b97f4a7c15));
+    }
+};
+
+struct CachedResult {
+    std::string output;
+    Machine::Status status;
+    std::uint64_t steps;
+};
+
+/* Memoized results of deterministic runs, bounded by the bytes of output kept in memory. Entries
+ * evicted from memory are written to `spillDir` (if set) and read back on a later hit. Thread safe. */
+class ResultCache {
+public:
+    ResultCache(std::size_t const maxBytes, char const* const spillDir) : maxBytes_{ maxBytes }, spillDir_{ spillDir ? spillDir : "" } {}
+
+    [[nodiscard]] auto find(ResultKey const& key) -> std::shared_ptr<CachedResult const> {
+        {
+            std::lock_guard const lock{ mutex_ };
+            if (auto const found = index_.find(key); found != index_.end()) {
+                entries_.splice(entries_.begin(), entries_, found->second);
+                ++hits_;
+                return found->second->second;
+            }
+        }
+        if (auto spilled = readSpilled(key)) {
+            ++diskHits_;
+            auto result = std::make_shared<CachedResult const>(std::move(*spilled));
+            if (result->output.size() <= maxBytes_) insert(key, result);
+            return result;
+        }
+        ++misses_;
+        return nullptr;
+    }
+
+    void insert(ResultKey const& key, std::shared_ptr<CachedResult const> result) {
+        if (result->output.size() > maxBytes_) { /* Straight to disk */
+            spill(key, *result);
+            return;
+        }
+        std::vector<Entry> evicted;
+        {
+            std::lock_guard const lock{ mutex_ };
+            if (index_.contains(key)) return;
+            bytes_ += result->output.size();
+            entries_.emplace_front(key, std::move(result));
+            index_.emplace(key, entries_.begin());
+            while (bytes_ > maxBytes_) {
+                bytes_ -= entries_.back().second->output.size();
+                index_.erase(entries_.back().first);
+                evicted.push_back(std::move(entries_.back()));
+                entries_.pop_back();
+            }
+        }
+        for (auto const& [evictedKey, evictedResult] : evicted) spill(evictedKey, *evictedResult);
+    }
+
+    /* Hit rate summary for the stats output */
+    [[nodiscard]] auto describe() const -> std::string {
+        auto const hits = hits_.load(), diskHits = diskHits_.load(), misses = misses_.load();
+        auto const lookups = hits + diskHits + misses;
+        std::ostringstream text;
+        text << "result cache: " << hits + diskHits << " hits (" << diskHits << " from disk), " << misses << " misses, hit rate "
+             << (lookups == 0 ? 0.0 : 100.0 * static_cast<double>(hits + diskHits) / static_cast<double>(lookups)) << "%\n";
+        return text.str();
+    }
+
+private:
+    using Entry = std::pair<ResultKey, std::shared_ptr<CachedResult const>>;
+
+    [[nodiscard]] auto spillPath(ResultKey const& key) const -> std::string {
+        char name[40];
+        std::snprintf(name, sizeof name, "/%016llx-%016llx", static_cast<unsigned long long>(key.program),
+                      static_cast<unsigned long long>(key.input));
+        return spillDir_ + name;
+    }
+
+    /* u8 status, u64 steps, output; renamed into place so readers never see half a file */
+    void spill(ResultKey const& key, CachedResult const& result) const {
+        if (spillDir_.empty()) return;
+        auto const path = spillPath(key);
+        auto const temporary = path + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream f{ temporary, std::ios::binary | std::ios::trunc };
+            auto const status = static_cast<std::uint8_t>(result.status);
+            f.write(reinterpret_cast<char const*>(&status), sizeof status);
+            f.write(reinterpret_cast<char const*>(&result.steps), sizeof result.steps);
+            f.write(result.output.data(), static_cast<std::streamsize>(result.output.size()));
+            if (not f) return;
+        }
+        std::rename(temporary.c_str(), path.c_str());
+    }
+
+    [[nodiscard]] auto readSpilled(ResultKey const& key) const -> std::optional<CachedResult> {
+        if (spillDir_.empty()) return std::nullopt;
+        std::ifstream f{ spillPath(key), std::ios::binary };
+        std::uint8_t status = 0;
+        CachedResult result{ {}, {}, 0 };
+        if (not f.read(reinterpret_cast<char*>(&status), sizeof status)
+            or not f.read(reinterpret_cast<char*>(&result.steps), sizeof result.steps))
+            return std::nullopt;
+        result.status = static_cast<Machine::Status>(status);
+        result.output.assign(std::istreambuf_iterator<char>{ f }, std::istreambuf_iterator<char>{});
+        return result;
+    }
+
+    std::size_t maxBytes_;
+    std::string spillDir_;
+    std::mutex mutex_;
+    std::list<Entry> entries_; /* Most recently used first */
+    std::unordered_map<ResultKey, std::list<Entry>::iterator, ResultKeyHash> index_;
+    std::size_t bytes_ = 0;
+    std::atomic<std::size_t> hits_{ 0 }, diskHits_{ 0 }, misses_{ 0 };
+};
+
+/* Passes everything through to `target` and keeps a copy */
+class TeeOutput final : public OutputBackend {
+public:
+    explicit TeeOutput(OutputBackend& target) noexcept : target_{ &target } {}
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        copy.append(data.data(), data.size());
+        return target_->flush(data);
+    }
+    void finish() override { target_->finish(); }
+    auto ready() -> bool override { return target_->ready(); }
+
+    std::string copy;
+
+private:
+    OutputBackend* target_;
+};
+
+/* Run `program` on `input`, or replay the stored result of an identical earlier run. Runs cut
+ * short by `limits.interrupt` depend on timing and are never stored. */
+auto executeMemoized(Program const& program, std::string_view const input, OutputBackend& sink, RunLimits const& limits,
+                     ResultCache* const cache) -> Execution {
+    MemoryInput inputBackend{ input };
+    if (cache == nullptr) {
+        Output out{ sink };
+        Input in{ inputBackend };
+        auto const run = execute(program, out, in, limits);
+        out.close();
+        return run;
+    }
+    ResultKey const key{ program.fingerprint ^ (limits.maxSteps * 0xff51afd7ed558ccd), hashBytes(input) };
+    if (auto const hit = cache->find(key)) {
+        Output out{ sink };
+        out.write(hit->output);
+        out.close();
+        return { hit->status, hit->steps, 0, true };
+    }
+    TeeOutput tee{ sink };
+    Output out{ tee };
+    Input in{ inputBackend };
+    auto const run = execute(program, out, in, limits);
+    out.close();
+    if (run.status != Machine::Status::Interrupted)
+        cache->insert(key, std::make_shared<CachedResult const>(CachedResult{ std::move(tee.copy), run.status, run.steps }));
+    return run;
+}
+
+/* Runs a fixed set of jobs on per-worker deques. A worker takes from the back of its own
+ * deque and, once that is empty, steals from the front of the others'. */
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned const workers) : queues_(std::max(workers, 1u)) {}
+
+    [[nodiscard]] auto workers() const noexcept { return static_cast<unsigned>(queues_.size()); }
+
+    /* Call `job(index, worker)` for every index in [0, jobCount); returns once all are done. */
+    template <typename Job>
+    void run(std::size_t const jobCount, Job const& job) {
+        /* Contiguous slices keep neighbouring jobs (often the same program) on one worker. */
+        for (std::size_t i = 0; i != jobCount; ++i)
+            queues_[i * queues_.size() / jobCount].jobs.push_back(i);
+
+        std::vector<std::jthread> threads;
+        for (unsigned worker = 0; worker != workers(); ++worker) {
+            threads.emplace_back([this, worker, &job] {
+                while (auto const index = next(worker)) job(*index, worker);
+            });
+        }
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::size_t> jobs;
+    };
+
+    [[nodiscard]] auto next(unsigned const worker) -> std::optional<std::size_t> {
+        {
+            auto& own = queues_[worker];
+            std::lock_guard const lock{ own.mutex };
+            if (not own.jobs.empty()) {
+                auto const index = own.jobs.back();
+                own.jobs.pop_back();
+                return index;
+            }
+        }
+        for (std::size_t i = 1; i != queues_.size(); ++i) {
+            auto& victim = queues_[(worker + i) % queues_.size()];
+            std::lock_guard const lock{ victim.mutex };
+            if (not victim.jobs.empty()) {
+                auto const index = victim.jobs.front();
+                victim.jobs.pop_front();
+                return index;
+            }
+        }
+        return std::nullopt; /* No job is ever added while running, so we are done. */
+    }
+
+    std::vector<Queue> queues_;
+};
+
+struct BatchJob {
+    std::string programPath;
+    std::string inputPath; /* Empty: no input */
+};
+
+/* One job per line: `<program> [<input>]`. Blank lines and lines starting with `#` are skipped. */
+[[nodiscard]] auto readManifest(char const* const path) -> std::optional<std::vector<BatchJob>> {
+    std::ifstream f{ path };
+    if (not f.is_open()) {
+        std::cerr << "Can't open the manifest " << path << '\n';
+        return std::nullopt;
+    }
+    std::vector<BatchJob> jobs;
+    for (std::string line; std::getline(f, line);) {
+        std::istringstream fields{ line };
+        BatchJob job;
+        if (not (fields >> job.programPath) or job.programPath.starts_with('#')) continue;
+        if (fields >> job.inputPath and job.inputPath == "-") job.inputPath.clear();
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+/* One input path per line (blank lines and `#` comments skipped); every job runs the same program. */
+[[nodiscard]] auto readInputList(char const* const path) -> std::optional<std::vector<BatchJob>> {
+    std::ifstream f{ path };
+    if (not f.is_open()) {
+        std::cerr << "Can't open the input list " << path << '\n';
+        return std::nullopt;
+    }
+    std::vector<BatchJob> jobs;
+    for (std::string line; std::getline(f, line);) {
+        std::istringstream fields{ line };
+        BatchJob job;
+        if (not (fields >> job.inputPath) or job.inputPath.starts_with('#')) continue;
+        if (job.inputPath == "-") job.inputPath.clear();
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+struct BatchSettings {
+    unsigned workers = 1;
+    int optimizationLevel = 1;
+    char const* outputDir = nullptr; /* Per-job output files; combined output if null */
+    /* Compiled once and shared read-only by every worker; the jobs' `programPath` is then unused. */
+    Program const* sharedProgram = nullptr;
+    RunLimits limits;
+    ResultCache* resultCache = nullptr;
+    MetricsSink* metrics = nullptr;
+};
+
+struct JobStats {
+    double seconds = 0;
+    std::size_t bytesIn = 0;
+    std::size_t bytesOut = 0;
+};
+
+/* `p` in [0, 1], nearest rank */
+[[nodiscard]] auto percentile(std::vector<double> const& sorted, double const p) -> double {
+    return sorted[static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5)];
+}
+
+/* p50/p90/p99/max of `seconds`, in milliseconds, on stderr */
+void printLatencies(std::vector<double> seconds) {
+    if (seconds.empty()) return;
+    std::sort(seconds.begin(), seconds.end());
+    std::cerr << "latency ms: p50 " << percentile(seconds, 0.5) * 1e3 << ", p90 " << percentile(seconds, 0.9) * 1e3
+              << ", p99 " << percentile(seconds, 0.99) * 1e3 << ", max " << seconds.back() * 1e3 << '\n';
+}
+
+/* Latency percentiles and aggregate throughput, on stderr */
+void reportBatchStats(std::vector<JobStats> const& stats, double const wallSeconds, ResultCache const* const cache) {
+    if (stats.empty()) return;
+    std::size_t bytesIn = 0, bytesOut = 0;
+    std::vector<double> latencies;
+    for (auto const& job : stats) {
+        bytesIn += job.bytesIn;
+        bytesOut += job.bytesOut;
+        latencies.push_back(job.seconds);
+    }
+    auto const mb = [&](std::size_t const bytes) { return static_cast<double>(bytes) / 1e6 / wallSeconds; };
+    std::cerr << stats.size() << " jobs in " << wallSeconds << " s: "
+              << static_cast<double>(stats.size()) / wallSeconds << " jobs/s, "
+              << mb(bytesIn) << " MB/s in, " << mb(bytesOut) << " MB/s out\n";
+    printLatencies(std::move(latencies));
+    if (cache != nullptr) std::cerr << cache->describe();
+}
+
+/* Compile (unless the program is shared) and run every job on a work-stealing pool. Each job's
+ * output goes to `<outputDir>/<index>.out`, or, without `outputDir`, into `combined` as
+ * `#<index> <status> <size>\n<bytes>\n` records in completion order. */
+[[nodiscard]] auto runBatch(std::vector<BatchJob> const& jobs, BatchSettings const& settings, Output& combined) -> bool {
+    WorkStealingPool pool{ settings.workers };
+    std::vector<StringOutput> outputs(pool.workers()); /* Reused by every job of a worker */
+    std::vector<JobStats> stats(jobs.size());
+    std::mutex combinedMutex;
+    std::atomic<std::size_t> failures{ 0 };
+
+    auto const batchStart = std::chrono::steady_clock::now();
+    pool.run(jobs.size(), [&](std::size_t const index, unsigned const worker) {
+        auto const start = std::chrono::steady_clock::now();
+        auto& job = jobs[index];
+        auto& output = outputs[worker];
+        output.clear();
+        std::string_view status = "ok";
+        try {
+            /* The whole input up front: the result cache needs its hash anyway. */
+            std::unique_ptr<MmapInput> mapped;
+            std::string read;
+            std::string_view input;
+            if (not job.inputPath.empty()) {
+                UniqueFd const inputFile{ ::open(job.inputPath.c_str(), O_RDONLY | O_CLOEXEC) };
+                if (not inputFile) throwErrno(job.inputPath.c_str());
+                if ((mapped = MmapInput::create(inputFile.get()))) input = mapped->bytes();
+                else {
+                    FdInput pipe{ inputFile.get() };
+                    for (std::span<char const> chunk; not (chunk = pipe.refill()).empty();) read.append(chunk.data(), chunk.size());
+                    input = read;
+                }
+                stats[index].bytesIn = input.size();
+            }
+            std::optional<Program> compiled;
+            std::optional<PerfCounters> phases; /* Timing only, for the metrics */
+            if (settings.metrics != nullptr and settings.sharedProgram == nullptr) phases.emplace(false);
+            auto const* program = settings.sharedProgram;
+            if (program == nullptr and (compiled = loadProgram(job.programPath.c_str(), settings.optimizationLevel, phases ? &*phases : nullptr)))
+                program = &*compiled;
+            if (program != nullptr) {
+                auto const executeStart = std::chrono::steady_clock::now();
+                auto const run = executeMemoized(*program, input, output, settings.limits, settings.resultCache);
+                if (auto const stop = describeStop(run.status)) status = stop;
+                if (settings.metrics != nullptr) {
+                    RunMetrics metrics;
+                    metrics.job = index;
+                    describeCompile(metrics, *program, phases ? &*phases : nullptr, settings.optimizationLevel);
+                    metrics.status = status.data();
+                    metrics.executeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - executeStart).count();
+                    metrics.steps = run.steps;
+                    if (not run.cached) metrics.tapeCells = run.tapeCells;
+                    metrics.bytesIn = input.size();
+                    metrics.bytesOut = output.view().size();
+                    if (settings.resultCache != nullptr) metrics.cacheHit = run.cached;
+                    settings.metrics->write(metrics);
+                }
+            }
+            else status = "no-source";
+        }
+        catch (std::exception const& e) {
+            std::cerr << "Job " << index << ": " << e.what() << '\n';
+            status = "error";
+        }
+        if (status != "ok") ++failures;
+        stats[index].bytesOut = output.view().size();
+        stats[index].seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (settings.outputDir != nullptr) {
+            auto const path = std::string{ settings.outputDir } + '/' + std::to_string(index) + ".out";
+            UniqueFd const file{ ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666) };
+            try {
+                if (not file) throwErrno(path.c_str());
+                writeAll(file.get(), output.view().data(), output.view().size());
+            }
+            catch (std::exception const& e) {
+                std::cerr << "Job " << index << ": " << e.what() << '\n';
+                ++failures;
+            }
+        }
+        else {
+            auto const header = '#' + std::to_string(index) + ' ' + std::string{ status } + ' '
+                + std::to_string(output.view().size()) + '\n';
+            std::lock_guard const lock{ combinedMutex };
+            combined.write(header);
+            combined.write(output.view());
+            combined.put('\n', 1);
+        }
+    });
+    reportBatchStats(stats, std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count(), settings.resultCache);
+    return failures == 0;
+}
+
+/* The ways this interpreter can run a program, for --bench and --verify */
+struct Engine {
+    enum class Kind {
+        Interpreter,
+        Reference, /* One `Machine::step` at a time: slow, but the plainest path there is */
+        Jit,
+    };
+
+    char const* name;
+    int optimizationLevel;
+    Kind kind;
+};
+
+/* With `reference`, the single-stepping engines come first, to compare the others against */
+[[nodiscard]] auto availableEngines(bool const reference = false) -> std::vector<Engine> {
+    std::vector<Engine> engines;
+    if (reference) engines = { { "ref-O0", 0, Engine::Kind::Reference }, { "ref-O1", 1, Engine::Kind::Reference } };
+    engines.push_back({ "interp-O0", 0, Engine::Kind::Interpreter });
+    engines.push_back({ "interp-O1", 1, Engine::Kind::Interpreter });
+#ifdef BF_HAVE_JIT
+    engines.push_back({ "jit-O0", 0, Engine::Kind::Jit });
+    engines.push_back({ "jit-O1", 1, Engine::Kind::Jit });
+#endif // BF_HAVE_JIT
+    return engines;
+}
+
+/* Compile `source` and run it on `input` with `engine`, output into `sink`. No limits. With
+ * `tapeHash`, the interpreters count steps (the JIT never does) and the final tape is hashed with `hashTape`. */
+auto runWithEngine(Engine const& engine, std::string_view const source, std::string_view const input, OutputBackend& sink,
+                   std::uint64_t* const tapeHash = nullptr) -> Execution {
+    auto const program = compileProgram(source, engine.optimizationLevel);
+    MemoryInput inputBackend{ input };
+    Output out{ sink };
+    Input in{ inputBackend };
+    Execution run{ Machine::Status::Finished, 0 };
+    if (engine.kind == Engine::Kind::Jit) {
+#ifdef BF_HAVE_JIT
+        JitProgram{ program }.run(out, in, tapeHash);
+#endif // BF_HAVE_JIT
+    }
+    else {
+        Machine machine{ program };
+        if (engine.kind == Engine::Kind::Reference) while (machine.step(out, in)) {}
+        else run.status = machine.run<false>(out, in, RunLimits{ SIZE_MAX, nullptr, tapeHash != nullptr });
+        run.steps = machine.steps();
+        run.tapeCells = machine.tapeCells();
+        if (tapeHash != nullptr) *tapeHash = hashTape(machine.tape().cells());
+    }
+    out.close();
+    return run;
+}
+
+struct Workload {
+    std::string name;
+    std::string source;
+    std::string input;
+};
+
+/* `<name> <program> [<input>]` per line, paths relative to the manifest; `#` starts a comment */
+[[nodiscard]] auto readSuite(char const* const manifestPath) -> std::optional<std::vector<Workload>> {
+    std::ifstream f{ manifestPath };
+    if (not f.is_open()) {
+        std::cerr << "Can't open the benchmark suite " << manifestPath << '\n';
+        return std::nullopt;
+    }
+    std::string_view const manifest = manifestPath;
+    auto const slash = manifest.rfind('/');
+    auto const base = slash == std::string_view::npos ? std::string{} : std::string{ manifest.substr(0, slash + 1) };
+    std::vector<Workload> workloads;
+    for (std::string line; std::getline(f, line);) {
+        std::istringstream fields{ line };
+        std::string name, program, input;
+        if (not (fields >> name >> program) or name.starts_with('#')) continue;
+        fields >> input;
+        auto source = readWholeFile((base + program).c_str());
+        auto inputBytes = input.empty() ? std::optional<std::string>{ "" } : readWholeFile((base + input).c_str());
+        if (not source or not inputBytes) {
+            std::cerr << "Can't read the files of workload " << name << '\n';
+            return std::nullopt;
+        }
+        workloads.push_back({ std::move(name), std::move(*source), std::move(*inputBytes) });
+    }
+    return workloads;
+}
+
+/* Wall-clock seconds of repeated runs */
+struct Timings {
+    std::vector<double> seconds; /* Sorted */
+
+    [[nodiscard]] auto median() const -> double { return percentile(seconds, 0.5); }
+    [[nodiscard]] auto mean() const -> double {
+        return std::accumulate(seconds.begin(), seconds.end(), 0.0) / static_cast<double>(seconds.size());
+    }
+    /* Half-width of the 95% confidence interval of the mean (Student's t) */
+    [[nodiscard]] auto confidence() const -> double {
+        auto const n = seconds.size();
+        if (n < 2) return 0;
+        constexpr std::array<double, 30> t{ 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+        auto const m = mean();
+        auto const variance = std::accumulate(seconds.begin(), seconds.end(), 0.0,
+                                              [&](double const sum, double const s) { return sum + (s - m) * (s - m); }) / static_cast<double>(n - 1);
+        return (n - 1 <= t.size() ? t[n - 2] : 1.96) * std::sqrt(variance / static_cast<double>(n));
+    }
+};
+
+struct BenchResult {
+    std::string workload;
+    char const* engine;
+    Timings timings;
+    bool outputMatches; /* Same output as the first engine */
+};
+
+/* --bench: every workload under every engine, `warmups` untimed runs then `runs` timed ones.
+ * Timings cover compiling and running, output kept in memory. */
+[[nodiscard]] auto runBenchmarks(std::vector<Workload> const& workloads, std::size_t const warmups, std::size_t const runs)
+        -> std::vector<BenchResult> {
+    std::vector<BenchResult> results;
+    for (auto const& workload : workloads) {
+        std::optional<std::string> reference;
+        for (auto const& engine : availableEngines()) {
+            StringOutput output;
+            for (std::size_t i = 0; i != warmups; ++i) {
+                output.clear();
+                runWithEngine(engine, workload.source, workload.input, output);
+            }
+            Timings timings;
+            for (std::size_t i = 0; i != runs; ++i) {
+                output.clear();
+                auto const start = std::chrono::steady_clock::now();
+                runWithEngine(engine, workload.source, workload.input, output);
+                timings.seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            }
+            std::sort(timings.seconds.begin(), timings.seconds.end());
+            if (not reference) reference.emplace(output.view());
+            results.push_back({ workload.name, engine.name, std::move(timings), output.view() == *reference });
+        }
+    }
+    return results;
+}
+
+void printBenchResults(std::ostream& os, std::vector<BenchResult> const& results) {
+    os << std::left << std::setw(14) << "workload" << std::setw(12) << "engine" << std::right << std::setw(12) << "median ms"
+       << std::setw(12) << "ci95 ms" << std::setw(12) << "min ms" << std::setw(7) << "runs" << '\n'
+       << std::fixed << std::setprecision(3);
+    for (auto const& result : results) {
+        auto const& seconds = result.timings.seconds;
+        os << std::left << std::setw(14) << result.workload << std::setw(12) << result.engine << std::right
+           << std::setw(12) << result.timings.median() * 1e3 << std::setw(12) << result.timings.confidence() * 1e3
+           << std::setw(12) << seconds.front() * 1e3 << std::setw(7) << seconds.size();
+        if (not result.outputMatches) os << "  OUTPUT DIFFERS";
+        os << '\n';
+    }
+    os << std::defaultfloat;
+}
+
+/* What benchmark timings depend on besides the code */
+struct MachineInfo {
+    std::string cpu;
+    unsigned cores;
+    std::string kernel;
+    std::string compiler;
+
+    /* Hex hash of all of the above: records with the same one are comparable */
+    [[nodiscard]] auto fingerprint() const -> std::string {
+        std::ostringstream hex;
+        hex << std::hex << std::setw(16) << std::setfill('0')
+            << hashBytes(cpu + '\n' + std::to_string(cores) + '\n' + kernel + '\n' + compiler);
+        return hex.str();
+    }
+};
+
+[[nodiscard]] auto describeMachine() -> MachineInfo {
+    MachineInfo machine{ "unknown", std::max(std::thread::hardware_concurrency(), 1u), "unknown", "unknown" };
+    std::ifstream cpuinfo{ "/proc/cpuinfo" };
+    for (std::string line; std::getline(cpuinfo, line);) {
+        if (line.starts_with("model name")) {
+            machine.cpu = line.substr(line.find(':') + 2);
+            break;
+        }
+    }
+    if (utsname name{}; ::uname(&name) == 0) machine.kernel = std::string{ name.sysname } + ' ' + name.release + ' ' + name.machine;
+#ifdef __VERSION__
+    machine.compiler = __VERSION__;
+#endif // __VERSION__
+    return machine;
+}
+
+[[nodiscard]] auto quoteJson(std::string_view const text) -> std::string {
+    std::string quoted{ '"' };
+    for (auto const ch : text) {
+        if (ch == '"' or ch == '\\') quoted += '\\';
+        quoted += ch;
+    }
+    return quoted += '"';
+}
+
+/* The value of `"key":` in a line `appendHistory` wrote: a string unquoted, anything else as written */
+[[nodiscard]] auto jsonField(std::string_view const line, std::string_view const key) -> std::optional<std::string> {
+    auto const name = quoteJson(key) + ':';
+    auto at = line.find(name);
+    if (at == std::string_view::npos) return std::nullopt;
+    at += name.size();
+    std::string value;
+    if (line[at] == '"') {
+        for (++at; at < line.size() and line[at] != '"'; ++at) value += line[at] == '\\' ? line[++at] : line[at];
+        return value;
+    }
+    auto const end = line[at] == '[' ? line.find(']', at) + 1 : line.find_first_of(",}", at);
+    return std::string{ line.substr(at, end - at) };
+}
+
+/* One (workload, engine) of a --bench run, as kept by --record */
+struct HistoryEntry {
+    std::string run; /* When the --bench run started; shared by all its entries */
+    std::string commit;
+    std::string machine;
+    std::string workload;
+    std::string engine;
+    std::vector<double> seconds; /* Sorted */
+};
+
+/* --record: append one JSON line per result to `path` */
+void appendHistory(char const* const path, std::vector<BenchResult> const& results, std::string_view const commit, MachineInfo const& machine) {
+    std::ofstream store{ path, std::ios::app };
+    if (not store) throw std::runtime_error(std::string{ "Can't append to the benchmark history " } + path);
+    auto const run = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    store << std::setprecision(9);
+    for (auto const& result : results) {
+        store << "{\"run\":\"" << run << "\",\"commit\":" << quoteJson(commit) << ",\"machine\":\"" << machine.fingerprint()
+              << "\",\"cpu\":" << quoteJson(machine.cpu) << ",\"cores\":" << machine.cores << ",\"kernel\":" << quoteJson(machine.kernel)
+              << ",\"compiler\":" << quoteJson(machine.compiler) << ",\"workload\":" << quoteJson(result.workload)
+              << ",\"engine\":" << quoteJson(result.engine) << ",\"output_matches\":" << (result.outputMatches ? "true" : "false")
+              << ",\"seconds\":[";
+        for (auto const& s : result.timings.seconds) store << (&s == &result.timings.seconds.front() ? "" : ",") << s;
+        store << "]}\n";
+    }
+}
+
+[[nodiscard]] auto readHistory(char const* const path) -> std::optional<std::vector<HistoryEntry>> {
+    std::ifstream store{ path };
+    if (not store) {
+        std::cerr << "Can't open the benchmark history " << path << '\n';
+        return std::nullopt;
+    }
+    std::vector<HistoryEntry> entries;
+    for (std::string line; std::getline(store, line);) {
+        auto run = jsonField(line, "run"), commit = jsonField(line, "commit"), machine = jsonField(line, "machine"),
+             workload = jsonField(line, "workload"), engine = jsonField(line, "engine"), seconds = jsonField(line, "seconds");
+        if (not run or not commit or not machine or not workload or not engine or not seconds) continue;
+        HistoryEntry entry{ std::move(*run), std::move(*commit), std::move(*machine), std::move(*workload), std::move(*engine), {} };
+        std::replace(seconds->begin(), seconds->end(), ',', ' ');
+        std::istringstream values{ seconds->substr(1, seconds->size() - 2) };
+        for (double s; values >> s;) entry.seconds.push_back(s);
+        std::sort(entry.seconds.begin(), entry.seconds.end());
+        if (not entry.seconds.empty()) entries.push_back(std::move(entry));
+    }
+    return entries;
+}
+
+/* One-sided Mann-Whitney U test: the chance of `candidate` looking at least this much slower than
+ * `baseline` if both came from the same distribution. Exact for small samples without ties,
+ * normal approximation with tie correction otherwise. */
+[[nodiscard]] auto mannWhitneySlower(std::vector<double> const& baseline, std::vector<double> const& candidate) -> double {
+    auto const m = baseline.size(), n = candidate.size();
+    double u = 0; /* Pairs where the candidate is slower, ties counting half */
+    bool ties = false;
+    for (auto const b : baseline)
+        for (auto const c : candidate) {
+            u += c > b ? 1 : c == b ? 0.5 : 0;
+            ties = ties or c == b;
+        }
+    if (not ties and m <= 30 and n <= 30) {
+        /* ways[j][k]: orderings of `i` baseline and `j` candidate values with U = k, built up over `i` */
+        std::vector<std::vector<double>> ways(n + 1, std::vector<double>(m * n + 1, 0));
+        for (auto& w : ways) w[0] = 1;
+        for (std::size_t i = 1; i <= m; ++i)
+            for (std::size_t j = 1; j <= n; ++j) /* The largest value is either a candidate (beating all i) or not */
+                for (auto k = m * n; k != SIZE_MAX; --k) ways[j][k] = (k >= i ? ways[j - 1][k - i] : 0) + ways[j][k];
+        auto const& counts = ways[n];
+        auto const total = std::accumulate(counts.begin(), counts.end(), 0.0);
+        return std::accumulate(counts.begin() + static_cast<std::ptrdiff_t>(u), counts.end(), 0.0) / total;
+    }
+    std::vector<double> all{ baseline };
+    all.insert(all.end(), candidate.begin(), candidate.end());
+    std::sort(all.begin(), all.end());
+    double tieTerm = 0;
+    for (auto it = all.begin(); it != all.end();) {
+        auto const next = std::upper_bound(it, all.end(), *it);
+        auto const t = static_cast<double>(next - it);
+        tieTerm += t * t * t - t;
+        it = next;
+    }
+    auto const size = static_cast<double>(m + n), pairs = static_cast<double>(m * n);
+    auto const variance = pairs / 12 * (size + 1 - tieTerm / (size * (size - 1)));
+    if (variance <= 0) return 1;
+    return 0.5 * std::erfc((u - pairs / 2 - 0.5) / std::sqrt(2 * variance));
+}
+
+/* --compare: every (workload, engine) the two runs share. `baseline` and `candidate` are commit
+ * prefixes, each meaning the latest run of that commit; by default the last two runs in the store.
+ * Returns false if any got significantly slower at level `alpha`. */
+[[nodiscard]] auto compareHistory(std::vector<HistoryEntry> const& entries, char const* const baseline, char const* const candidate,
+                                  double const alpha, std::ostream& os) -> bool {
+    std::vector<std::string> runs; /* In order of appearance */
+    for (auto const& entry : entries)
+        if (runs.empty() or runs.back() != entry.run) runs.push_back(entry.run);
+    auto const latestRun = [&](char const* const commit, std::size_t const fromEnd) -> std::optional<std::string> {
+        if (commit == nullptr) return runs.size() > fromEnd ? std::optional{ runs[runs.size() - 1 - fromEnd] } : std::nullopt;
+        for (auto it = entries.rbegin(); it != entries.rend(); ++it)
+            if (it->commit.starts_with(commit)) return it->run;
+        return std::nullopt;
+    };
+    auto const before = latestRun(baseline, 1), after = latestRun(candidate, 0);
+    if (not before or not after) {
+        std::cerr << "The benchmark history has no such runs to compare\n";
+        return false;
+    }
+    auto const entriesOf = [&](std::string const& run) {
+        std::vector<HistoryEntry const*> of;
+        for (auto const& entry : entries)
+            if (entry.run == run) of.push_back(&entry);
+        return of;
+    };
+    auto const old = entriesOf(*before), now = entriesOf(*after);
+    os << "baseline  " << old.front()->commit << " (run " << *before << ")\ncandidate " << now.front()->commit << " (run " << *after << ")\n";
+    if (old.front()->machine != now.front()->machine) os << "Warning: the runs were recorded on different machines\n";
+    os << std::left << std::setw(14) << "workload" << std::setw(12) << "engine" << std::right << std::setw(14) << "baseline ms"
+       << std::setw(14) << "candidate ms" << std::setw(9) << "change" << std::setw(9) << "p" << '\n';
+    std::size_t regressions = 0;
+    for (auto const* const a : old) {
+        auto const b = std::find_if(now.begin(), now.end(), [&](HistoryEntry const* e) { return e->workload == a->workload and e->engine == a->engine; });
+        if (b == now.end()) continue;
+        auto const oldMedian = percentile(a->seconds, 0.5), newMedian = percentile((*b)->seconds, 0.5);
+        auto const slower = mannWhitneySlower(a->seconds, (*b)->seconds), faster = mannWhitneySlower((*b)->seconds, a->seconds);
+        os << std::left << std::setw(14) << a->workload << std::setw(12) << a->engine << std::right << std::fixed << std::setprecision(3)
+           << std::setw(14) << oldMedian * 1e3 << std::setw(14) << newMedian * 1e3 << std::showpos << std::setprecision(1)
+           << std::setw(8) << (newMedian / oldMedian - 1) * 100 << '%' << std::noshowpos << std::setprecision(4)
+           << std::setw(9) << std::min(slower, faster) << std::defaultfloat;
+        if (slower < alpha) {
+            os << "  REGRESSION";
+            ++regressions;
+        }
+        else if (faster < alpha) os << "  faster";
+        os << '\n';
+    }
+    os << regressions << " significant regressions (one-sided Mann-Whitney U, alpha " << alpha << ")\n";
+    return regressions == 0;
+}
+
+/* Makes the optimizer assume `value` is used, so the work that produced it is kept */
+template <typename T>
+inline void keep(T const& value) noexcept {
+#ifdef __GNUC__
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static T volatile sink;
+    sink = value;
+#endif // __GNUC__
+}
+
+/* `size` bytes of which about `commandPercent`% are commands and the rest comment text. The
+ * generator is fully specified by the standard, so every build parses the same bytes. */
+[[nodiscard]] auto syntheticSource(std::size_t const size, unsigned const commandPercent) -> std::string {
+    constexpr std::string_view commands = "+-<>.,[]", text = "the quick brown fox jumps over a lazy dog\n";
+    std::minstd_rand rng{ 1 };
+    std::string source(size, ' ');
+    for (auto& ch : source) ch = rng() % 100 < commandPercent ? commands[rng() % commands.size()] : text[rng() % text.size()];
+    return source;
+}
+
+/* `pattern` repeated to 256 commands, run 255 * 255 times on cell 2. The pattern must leave the
+ * pointer where it found it and execute each of its commands exactly once. */
+[[nodiscard]] auto dispatchProgram(std::string_view const pattern) -> std::string {
+    std::string body;
+    while (body.size() < 256) body += pattern;
+    return "-[>-[>" + body + "<-]<-]";
+}
+
+/* A random walk of +1/-1 steps that stays within `cells` and ends where it started */
+[[nodiscard]] auto tapeWalk(std::size_t const length, std::size_t const cells) -> std::vector<std::int8_t> {
+    std::minstd_rand rng{ 1 };
+    std::vector<std::int8_t> walk;
+    std::size_t position = 0;
+    while (walk.size() != length / 2) {
+        auto const right = position == 0 or (position + 1 != cells and rng() % 2 == 0);
+        walk.push_back(right ? 1 : -1);
+        position = right ? position + 1 : position - 1;
+    }
+    for (auto i = walk.size(); i-- != 0;) walk.push_back(static_cast<std::int8_t>(-walk[i]));
+    return walk;
+}
+
+/* An anonymous mapping reserved the way the JIT reserves its tape */
+class FlatTape {
+public:
+    explicit FlatTape(std::size_t const size) : size_{ size } {
+        auto* const addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (addr == MAP_FAILED) throwErrno("mmap");
+        cells_ = static_cast<char*>(addr);
+    }
+    FlatTape(FlatTape const&) = delete;
+    auto operator=(FlatTape const&) -> FlatTape& = delete;
+    ~FlatTape() { ::munmap(cells_, size_); }
+
+    [[nodiscard]] auto data() const noexcept { return cells_; }
+
+private:
+    std::size_t size_;
+    char* cells_;
+};
+
+/* --micro: parser, dispatch, tape and output sink costs on fixed synthetic workloads, so two builds
+ * can be compared number for number. Each benchmark is calibrated to at least 50 ms per sample;
+ * prints the median and the 95% confidence interval over `samples` samples. */
+void runMicroBenchmarks(std::ostream& os, std::string_view const filter, std::size_t const samples) {
+    os << std::left << std::setw(28) << "benchmark" << std::right << std::setw(12) << "median" << std::setw(12) << "ci95" << "  unit\n"
+       << std::fixed << std::setprecision(3);
+    /* `f` does `ops` operations per call; `bytes` if those are bytes, to report MB/s rather than ns/op */
+    auto const bench = [&](std::string const& name, std::size_t const ops, bool const bytes, auto&& f) {
+        if (name.find(filter) == std::string::npos) return;
+        using clock = std::chrono::steady_clock;
+        auto const since = [](clock::time_point const start) { return std::chrono::duration<double>(clock::now() - start).count(); };
+        auto start = clock::now();
+        f();
+        auto const calls = static_cast<std::size_t>(std::ceil(0.05 / std::max(since(start), 1e-9)));
+        Timings perOp;
+        for (std::size_t i = 0; i != samples; ++i) {
+            start = clock::now();
+            for (std::size_t j = 0; j != calls; ++j) f();
+            perOp.seconds.push_back(since(start) / static_cast<double>(calls * ops));
+        }
+        std::sort(perOp.seconds.begin(), perOp.seconds.end());
+        auto const median = perOp.median();
+        os << std::left << std::setw(28) << name << std::right;
+        if (bytes) os << std::setw(12) << 1e-6 / median << std::setw(12) << 1e-6 / median * perOp.confidence() / median << "  MB/s\n";
+        else os << std::setw(12) << median * 1e9 << std::setw(12) << perOp.confidence() * 1e9 << "  ns/op\n";
+        os.flush();
+    };
+
+    constexpr std::size_t sourceBytes = std::size_t{ 8 } << 20;
+    for (auto const& [name, commandPercent] : { std::pair{ "parse/comment-heavy", 10u }, std::pair{ "parse/dense", 100u } }) {
+        auto const source = syntheticSource(sourceBytes, commandPercent);
+        std::vector<SourceSpan> spans;
+        bench(name, sourceBytes, true, [&] {
+            spans.clear();
+            keep(generateSourceCode(source.begin(), source.end(), &spans).size());
+        });
+    }
+
+    /* Ops are the pattern's commands; the loop around them adds about 1.5% */
+    for (auto const& engine : availableEngines()) {
+        for (auto const& [name, pattern] : { std::pair{ "arith", "+-" }, std::pair{ "move", "><" }, std::pair{ "output", "." }, std::pair{ "loop", "+[-]" } }) {
+            auto const source = dispatchProgram(pattern);
+            DiscardOutput sink;
+            bench(std::string{ "dispatch/" } + engine.name + '/' + name, 255 * 255 * 256, false, [&] { runWithEngine(engine, source, "", sink); });
+        }
+    }
+
+    constexpr std::size_t walkCells = std::size_t{ 1 } << 16, growCells = std::size_t{ 16 } << 20;
+    auto const walk = tapeWalk(std::size_t{ 1 } << 22, walkCells);
+    {
+        Pointer p{ walkCells };
+        bench("tape/deque/move+inc", walk.size(), false, [&] {
+            for (auto const step : walk) {
+                if (step > 0) ++p;
+                else --p;
+                operation<'+'>(*p, 1);
+            }
+            keep(*p);
+        });
+        bench("tape/deque/grow", growCells, false, [&] {
+            Pointer fresh;
+            for (std::size_t i = 1; i != growCells; ++i) operation<'+'>(*++fresh, 1);
+            keep(*fresh);
+        });
+    }
+    {
+        FlatTape const tape{ walkCells };
+        bench("tape/flat/move+inc", walk.size(), false, [&] {
+            auto* p = tape.data();
+            for (auto const step : walk) {
+                p += step;
+                operation<'+'>(*p, 1);
+            }
+            keep(*p);
+        });
+        bench("tape/flat/grow", growCells, false, [&] {
+            FlatTape const fresh{ growCells };
+            for (auto* p = fresh.data() + 1; p != fresh.data() + growCells; ++p) {
+                operation<'+'>(*p, 1);
+                keep(p); /* One cell at a time, as `>+` would, rather than vectorized */
+            }
+        });
+    }
+
+    /* One `put` per byte, as `.` does */
+    constexpr std::size_t outputBytes = std::size_t{ 16 } << 20;
+    auto const writeThrough = [&](OutputBackend& backend) {
+        Output out{ backend };
+        for (std::size_t i = 0; i != outputBytes; ++i) out.put(static_cast<char>(i), 1);
+        out.close();
+    };
+    UniqueFd const devNull{ ::open("/dev/null", O_WRONLY | O_CLOEXEC) };
+    if (not devNull) throwErrno("open /dev/null");
+    {
+        DiscardOutput sink;
+        bench("output/discard", outputBytes, true, [&] { writeThrough(sink); });
+    }
+    {
+        StringOutput sink;
+        bench("output/memory", outputBytes, true, [&] {
+            writeThrough(sink);
+            sink.clear();
+        });
+    }
+    {
+        FdOutput sink{ devNull.get() };
+        bench("output/fd", outputBytes, true, [&] { writeThrough(sink); });
+    }
+    {
+        char path[] = "/tmp/bf-micro-XXXXXX";
+        UniqueFd const file{ ::mkstemp(path) };
+        if (not file) throwErrno("mkstemp");
+        ::unlink(path);
+        bench("output/mmap", outputBytes, true, [&] { writeThrough(*MmapOutput::create(file.get())); });
+    }
+#ifdef BF_HAVE_IO_URING
+    if (auto ring = IoUring::create()) {
+        UringOutput sink{ std::move(ring), devNull.get() };
+        bench("output/uring", outputBytes, true, [&] { writeThrough(sink); });
+    }
+#endif // BF_HAVE_IO_URING
+    os << std::defaultfloat;
+}
+
+/* --verify: the `.b`/`.bf` files of a directory, or the one file given */
+[[nodiscard]] auto listPrograms(char const* const path) -> std::vector<std::string> {
+    std::error_code error;
+    if (not std::filesystem::is_directory(path, error)) return { path };
+    std::vector<std::string> programs;
+    for (auto const& entry : std::filesystem::directory_iterator{ path, error })
+        if (entry.is_regular_file() and (entry.path().extension() == ".b" or entry.path().extension() == ".bf"))
+            programs.push_back(entry.path().string());
+    std::sort(programs.begin(), programs.end());
+    return programs;
+}
+
+/* How one engine ran one program */
+struct EngineRun {
+    Engine engine;
+    std::string output;
+    std::uint64_t tapeHash = 0;
+    std::size_t steps = 0; /* Not counted by the JIT */
+    double seconds = 0;    /* Median */
+    std::string error;     /* The exception it stopped with, if any */
+};
+
+/* Run `source` under `engine` `runs` times: the outcome of the last run, the median time */
+[[nodiscard]] auto runEngine(Engine const& engine, std::string_view const source, std::string_view const input, std::size_t const runs)
+        -> EngineRun {
+    EngineRun result;
+    result.engine = engine;
+    StringOutput output;
+    Timings timings;
+    try {
+        for (std::size_t i = 0; i != runs; ++i) {
+            output.clear();
+            auto const start = std::chrono::steady_clock::now();
+            result.steps = runWithEngine(engine, source, input, output, &result.tapeHash).steps;
+            timings.seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(timings.seconds.begin(), timings.seconds.end());
+        result.seconds = timings.median();
+        result.output = output.view();
+    }
+    catch (std::exception const& e) {
+        result.error = e.what();
+        result.output = output.view(); /* What it printed before failing */
+    }
+    return result;
+}
+
+/* Describe how `run` differs from `reference`, if at all */
+[[nodiscard]] auto describeDivergence(EngineRun const& run, EngineRun const& reference) -> std::string {
+    std::ostringstream description;
+    if (run.error != reference.error) {
+        description << (run.error.empty() ? "finished" : "failed: " + run.error) << ", " << reference.engine.name << ' '
+                    << (reference.error.empty() ? "finished" : "failed: " + reference.error);
+        return description.str();
+    }
+    auto const [mine, theirs] = std::mismatch(run.output.begin(), run.output.end(), reference.output.begin(), reference.output.end());
+    if (mine != run.output.end() or theirs != reference.output.end()) {
+        auto const byte = [](std::string const& output, std::string::const_iterator const at) {
+            std::ostringstream os;
+            if (at == output.end()) os << "end of output";
+            else os << "0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<unsigned>(static_cast<unsigned char>(*at));
+            return os.str();
+        };
+        description << "output differs from " << reference.engine.name << " at byte " << mine - run.output.begin() << ": "
+                    << byte(run.output, mine) << " vs " << byte(reference.output, theirs);
+    }
+    else if (run.tapeHash != reference.tapeHash) description << "final tape differs from " << reference.engine.name;
+    return description.str();
+}
+
+/* Check that every run agrees with the first (the unoptimized reference) on output and final tape,
+ * and with the first run at its own optimization level on steps */
+[[nodiscard]] auto findDivergences(std::vector<EngineRun> const& results) -> std::vector<std::string> {
+    std::vector<std::string> divergences;
+    auto const& reference = results.front();
+    for (auto const& result : results) {
+        if (&result == &reference) continue;
+        if (auto const divergence = describeDivergence(result, reference); not divergence.empty())
+            divergences.push_back(result.engine.name + (' ' + divergence));
+        if (result.engine.kind == Engine::Kind::Jit or not result.error.empty()) continue;
+        auto const& counted = *std::find_if(results.begin(), results.end(), [&](EngineRun const& r) {
+            return r.engine.optimizationLevel == result.engine.optimizationLevel;
+        });
+        if (&counted != &result and counted.error.empty() and counted.steps != result.steps)
+            divergences.push_back(result.engine.name + (" executed " + std::to_string(result.steps)) + " steps, "
+                                  + counted.engine.name + ' ' + std::to_string(counted.steps));
+    }
+    return divergences;
+}
+
+/* --verify: run every program under every engine, `runs` times each, and check them with
+ * `findDivergences` and against its `.out` file, if any. Prints the median times side by side,
+ * then the divergences. Programs must terminate. */
+[[nodiscard]] auto verifyPrograms(std::vector<std::string> const& paths, std::string_view const input, std::size_t const runs,
+                                  std::ostream& os) -> bool {
+    auto const engines = availableEngines(true);
+    std::size_t nameWidth = 8;
+    for (auto const& path : paths) nameWidth = std::max(nameWidth, path.size() + 2);
+    os << std::left << std::setw(static_cast<int>(nameWidth)) << "program" << std::right;
+    for (auto const& engine : engines) os << std::setw(12) << engine.name;
+    os << "  (median ms)\n" << std::fixed << std::setprecision(3);
+
+    std::vector<std::string> divergences;
+    for (auto const& path : paths) {
+        os << std::left << std::setw(static_cast<int>(nameWidth)) << path << std::right << std::flush;
+        auto const source = readWholeFile(path.c_str());
+        if (not source) {
+            os << "can't read\n";
+            divergences.push_back(path + ": can't read the file");
+            continue;
+        }
+        std::vector<EngineRun> results;
+        for (auto const& engine : engines) {
+            auto const& result = results.emplace_back(runEngine(engine, *source, input, runs));
+            if (result.error.empty()) os << std::setw(12) << result.seconds * 1e3 << std::flush;
+            else os << std::setw(12) << "failed" << std::flush;
+        }
+        os << '\n';
+        for (auto const& divergence : findDivergences(results)) divergences.push_back(path + ": " + divergence);
+        /* A `<name>.out` next to the program is the output the reference must produce, even when it fails */
+        if (auto const expected = readWholeFile(std::filesystem::path{ path }.replace_extension(".out").c_str());
+            expected and *expected != results.front().output)
+            divergences.push_back(path + ": " + results.front().engine.name + " output differs from the .out file");
+    }
+    os << std::defaultfloat;
+    for (auto const& divergence : divergences) os << "DIVERGES  " << divergence << '\n';
+    os << paths.size() << " programs, " << engines.size() << " engines, " << divergences.size() << " divergences\n";
+    return divergences.empty();
+}
+
+/* --generate: the shape of the random programs */
+struct GeneratorSettings {
+    std::uint64_t bytes = 4096; /* Stop at the first statement that reaches this size */
+    unsigned loopDepth = 3;
+    unsigned idiomPercent = 20; /* Statements that are idioms the optimizer folds, or nearly does */
+    unsigned ioPercent = 5;     /* Statements that are `.` or `,` */
+    bool unbalanced = false;    /* Now and then a stray `[` or `]` */
+};
+
+/* The generator's decisions from a seeded PRNG; std::mt19937_64 is the same everywhere */
+class RandomChoices {
+public:
+    explicit RandomChoices(std::uint64_t const seed) : rng_{ seed } {}
+
+    [[nodiscard]] auto below(unsigned const n) -> unsigned { return static_cast<unsigned>(rng_() % n); }
+
+private:
+    std::mt19937_64 rng_;
+};
+
+/* The generator's decisions from a fuzzer's input, a byte each. Zeros once it runs out, which
+ * always picks the shortest way to finish. */
+class ByteChoices {
+public:
+    explicit ByteChoices(std::span<std::uint8_t const> const bytes) noexcept : bytes_{ bytes } {}
+
+    [[nodiscard]] auto below(unsigned const n) noexcept -> unsigned {
+        if (bytes_.empty()) return 0;
+        auto const byte = bytes_.front();
+        bytes_ = bytes_.subspan(1);
+        return byte % n;
+    }
+
+    [[nodiscard]] auto exhausted() const noexcept { return bytes_.empty(); }
+
+private:
+    std::span<std::uint8_t const> bytes_;
+};
+
+/* Random programs that never move left of the first cell and, unless `unbalanced`, terminate:
+ * every loop is `[-...]` around a body that stays right of its counter and comes back to it, so it
+ * runs at most 255 times. Scans (`[>]`) only happen outside loops, which only need the position
+ * relative to where they start. */
+template <typename Choices>
+class ProgramGenerator {
+public:
+    static constexpr std::size_t window = 16;   /* Cells a top-level statement or a loop body uses */
+    static constexpr unsigned maxBodyItems = 6;
+
+    ProgramGenerator(GeneratorSettings const& settings, Choices& choices) noexcept : settings_{ settings }, choices_{ &choices } {}
+
+    /* Append one top-level statement */
+    void statement(std::string& text) {
+        if (settings_.unbalanced and chance(1)) {
+            text += choices_->below(2) == 0 ? ']' : '[';
+            return;
+        }
+        if (chance(settings_.idiomPercent / 4)) {
+            text += "[>]";
+            return;
+        }
+        item(text, position_, 0, window, 0);
+    }
+
+private:
+    /* Percent chance; a 0 from `Choices` is always a no */
+    [[nodiscard]] auto chance(unsigned const percent) -> bool { return choices_->below(100) >= 100 - percent; }
+
+    /* One command or construct on the cells [lo, hi] */
+    void item(std::string& text, std::size_t& position, std::size_t const lo, std::size_t const hi, unsigned const depth) {
+        if (chance(settings_.ioPercent)) {
+            text += choices_->below(4) == 0 ? ',' : '.';
+            return;
+        }
+        if (chance(settings_.idiomPercent)) {
+            idiom(text, position, lo, hi);
+            return;
+        }
+        switch (choices_->below(4)) {
+            case 0:
+                arithmetic(text);
+                break;
+            case 1: {
+                auto const target = lo + choices_->below(static_cast<unsigned>(hi - lo + 1));
+                moveTo(text, position, target);
+                break;
+            }
+            default:
+                if (depth < settings_.loopDepth) loop(text, position, depth);
+                else arithmetic(text);
+                break;
+        }
+    }
+
+    void arithmetic(std::string& text) {
+        auto const count = 1 + choices_->below(8);
+        text.append(count, choices_->below(2) == 0 ? '+' : '-');
+    }
+
+    void moveTo(std::string& text, std::size_t& position, std::size_t const target) {
+        if (target > position) text.append(target - position, '>');
+        else text.append(position - target, '<');
+        position = target;
+    }
+
+    /* `[-` body `]` on the cells right of the counter */
+    void loop(std::string& text, std::size_t const counter, unsigned const depth) {
+        text += "[-";
+        auto position = counter;
+        auto const first = counter + 1 + choices_->below(window);
+        moveTo(text, position, first);
+        auto const items = 1 + choices_->below(maxBodyItems);
+        for (unsigned i = 0; i != items; ++i) item(text, position, counter + 1, counter + window, depth + 1);
+        moveTo(text, position, counter);
+        text += ']';
+    }
+
+    /* Clear loops (odd steps only: an even one can miss zero), transfer and multiply loops,
+     * and constants set right after a clear */
+    void idiom(std::string& text, std::size_t& position, std::size_t const lo, std::size_t const hi) {
+        switch (choices_->below(3)) {
+            case 0: {
+                auto const step = 2 * choices_->below(2) + 1;
+                text += '[';
+                text.append(step, choices_->below(2) == 0 ? '-' : '+');
+                text += ']';
+                break;
+            }
+            case 1: {
+                auto const counter = position;
+                auto const targets = 1 + choices_->below(3);
+                text += "[-";
+                for (unsigned i = 0; i != targets; ++i) {
+                    auto const target = lo + choices_->below(static_cast<unsigned>(hi - lo + 1));
+                    if (target == counter) continue;
+                    moveTo(text, position, target);
+                    arithmetic(text);
+                }
+                moveTo(text, position, counter);
+                text += ']';
+                break;
+            }
+            default:
+                text += "[-]";
+                arithmetic(text);
+                break;
+        }
+    }
+
+    GeneratorSettings settings_;
+    Choices* choices_;
+    std::size_t position_ = 0; /* Relative to the last scan, which only ever moves right */
+};
+
+/* --generate: write statements until there are `settings.bytes` of them */
+void generateProgram(GeneratorSettings const& settings, std::uint64_t const seed, Output& out) {
+    RandomChoices choices{ seed };
+    ProgramGenerator generator{ settings, choices };
+    std::string statement;
+    for (std::uint64_t written = 0; written < settings.bytes; written += statement.size()) {
+        statement.clear();
+        generator.statement(statement);
+        out.write(statement);
+    }
+}
+
+#ifdef BF_FUZZER
+/* libFuzzer entry point, for a build with -DBF_FUZZER -fsanitize=fuzzer: the input steers the
+ * generator and every engine must agree with the reference on the program it makes. */
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* const data, std::size_t const size) {
+    GeneratorSettings settings;
+    settings.loopDepth = 1; /* Idiom loops nest inside, so up to 255 * 255 iterations */
+    settings.idiomPercent = 30;
+    settings.ioPercent = 10;
+    ByteChoices choices{ { data, size } };
+    ProgramGenerator generator{ settings, choices };
+    std::string source;
+    while (not choices.exhausted()) generator.statement(source);
+    std::vector<EngineRun> results;
+    for (auto const& engine : availableEngines(true)) results.push_back(runEngine(engine, source, "fuzz", 1));
+    auto const divergences = findDivergences(results);
+    if (divergences.empty()) return 0;
+    std::cerr << source << '\n';
+    for (auto const& divergence : divergences) std::cerr << divergence << '\n';
+    std::abort();
+}
+#endif // BF_FUZZER
+
+/* Nonblocking read(2) for the multiplexed scheduler. `ready` does the read and keeps what it got,
+ * so `refill` never waits: the scheduler asks `ready` before every `,` and parks the task in epoll
+ * when the answer is no. */
+class NonblockingFdInput final : public InputBackend {
+public:
+    explicit NonblockingFdInput(int const fd) : fd_{ fd }, buffer_(ioBufferSize) {}
+
+    auto refill() -> std::span<char const> override {
+        [[maybe_unused]] auto const readable = ready();
+        assert(readable);
+        read_ = false;
+        return { buffer_.data(), got_ };
+    }
+
+    auto ready() -> bool override {
+        while (not read_) {
+            auto const got = ::read(fd_, buffer_.data(), buffer_.size());
+            if (got >= 0) {
+                got_ = static_cast<std::size_t>(got);
+                read_ = true;
+            }
+            else if (errno == EAGAIN or errno == EWOULDBLOCK) return false;
+            else if (errno != EINTR) throwErrno("read");
+        }
+        return true;
+    }
+
+private:
+    int fd_;
+    std::vector<char> buffer_;
+    std::size_t got_ = 0;
+    bool read_ = false; /* `buffer_` holds a chunk `refill` hasn't handed out */
+};
+
+/* Output for the multiplexed scheduler: `flush` never blocks, it writes what the fd takes and
+ * keeps the rest. Once a buffer's worth is backed up, `ready` turns false and the program yields. */
+class NonblockingFdOutput final : public OutputBackend {
+public:
+    explicit NonblockingFdOutput(int const fd) : fd_{ fd } {}
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        if (data.data() != nullptr) size_ = static_cast<std::size_t>(data.data() + data.size() - storage_.data());
+        drain();
+        if (sent_ == size_) sent_ = size_ = 0;
+        else if (sent_ >= storage_.size() / 2) { /* Compact */
+            std::copy(storage_.begin() + static_cast<std::ptrdiff_t>(sent_), storage_.begin() + static_cast<std::ptrdiff_t>(size_), storage_.begin());
+            size_ -= std::exchange(sent_, 0);
+        }
+        if (storage_.size() - size_ < ioBufferSize) storage_.resize(size_ + ioBufferSize);
+        return { storage_.data() + size_, ioBufferSize };
+    }
+
+    /* The scheduler parks the task on EPOLLOUT until `pending` is 0 before it closes the output,
+     * so this never has to wait */
+    void finish() override { drain(); }
+
+    /* Writes first: after epoll reports room, the answer has to change */
+    auto ready() -> bool override {
+        drain();
+        return size_ - sent_ < ioBufferSize;
+    }
+
+    [[nodiscard]] auto pending() const noexcept { return size_ - sent_; }
+
+    /* Write as much as the fd takes right now */
+    void drain() {
+        while (sent_ != size_) {
+            auto const written = ::write(fd_, storage_.data() + sent_, size_ - sent_);
+            if (written < 0) {
+                if (errno == EAGAIN or errno == EWOULDBLOCK) return;
+                if (errno != EINTR) throwErrno("write");
+                continue;
+            }
+            sent_ += static_cast<std::size_t>(written);
+        }
+    }
+
+private:
+    int fd_;
+    std::string storage_;
+    std::size_t size_ = 0;
+    std::size_t sent_ = 0;
+};
+
+/* One multiplexed program with its own tape and I/O */
+struct Task {
+    Task(Program compiled, UniqueFd input, UniqueFd output)
+            : program{ std::move(compiled) }, inputFd{ std::move(input) }, outputFd{ std::move(output) },
+              inputBackend{ inputFd.get() }, outputBackend{ outputFd.get() },
+              out{ outputBackend }, in{ inputBackend }, machine{ program } {}
+
+    Program program;
+    UniqueFd inputFd, outputFd;
+    NonblockingFdInput inputBackend;
+    NonblockingFdOutput outputBackend;
+    Output out;
+    Input in;
+    Machine machine;
+    std::size_t index = 0;
+    bool closing = false; /* Stopped; only its output is left to drain */
+};
+
+/* Multiplexes many programs on a few worker threads. A worker runs a task until it finishes,
+ * exhausts its step quota (back of the run queue) or would block on I/O; blocked tasks are
+ * parked in epoll and put back on the run queue when their fd becomes ready. A task that
+ * reaches `limits` is stopped. */
+class Scheduler {
+public:
+    static constexpr std::size_t stepQuota = 1 << 20;
+
+    Scheduler(std::vector<std::unique_ptr<Task>> tasks, RunLimits const& limits)
+            : tasks_{ std::move(tasks) }, limits_{ limits }, epoll_{ ::epoll_create1(EPOLL_CLOEXEC) } {
+        if (not epoll_) throwErrno("epoll_create1");
+        if (::pipe2(wakeup_, O_CLOEXEC | O_NONBLOCK) != 0) throwErrno("pipe2");
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = nullptr; /* The wakeup pipe */
+        ::epoll_ctl(epoll_.get(), EPOLL_CTL_ADD, wakeup_[0], &ev);
+        for (auto& task : tasks_) runnable_.push_back(task.get());
+        live_ = tasks_.size();
+    }
+
+    ~Scheduler() {
+        ::close(wakeup_[0]);
+        ::close(wakeup_[1]);
+    }
+
+    /* Returns false if any program failed */
+    [[nodiscard]] auto run(unsigned const workers) -> bool {
+        {
+            std::vector<std::jthread> threads;
+            for (unsigned i = 0; i != std::max(workers, 1u); ++i) threads.emplace_back([this] { work(); });
+            poll();
+        }
+        return failures_ == 0;
+    }
+
+private:
+    void work() {
+        while (auto* const task = take()) {
+            try {
+                if (task->closing) {
+                    close(task);
+                    continue;
+                }
+                auto slice = limits_;
+                auto const quotaEnd = task->machine.steps() + stepQuota;
+                slice.maxSteps = std::min(limits_.maxSteps, quotaEnd);
+                switch (auto const status = task->machine.run<true>(task->out, task->in, slice)) {
+                    case Machine::Status::Finished:
+                        close(task);
+                        break;
+                    case Machine::Status::NeedInput:
+                        /* Nothing to read: show what the program has said so far. */
+                        task->out.flush();
+                        park(task, task->inputFd.get(), EPOLLIN);
+                        break;
+                    case Machine::Status::OutputFull:
+                        park(task, task->outputFd.get(), EPOLLOUT);
+                        break;
+                    case Machine::Status::StepLimit:
+                        if (slice.maxSteps == quotaEnd and quotaEnd < limits_.maxSteps) {
+                            makeRunnable(task); /* Just its time slice */
+                            break;
+                        }
+                        [[fallthrough]];
+                    case Machine::Status::Interrupted:
+                        std::cerr << "Program " << task->index << " stopped (" << describeStop(status) << ") after "
+                                  << task->machine.steps() << " instructions\n";
+                        ++failures_;
+                        close(task);
+                        break;
+                }
+            }
+            catch (std::exception const& e) {
+                std::cerr << "Program " << task->index << ": " << e.what() << '\n';
+                ++failures_;
+                /* Still deliver what it printed, unless that is what failed */
+                if (std::exchange(task->closing, true)) done(task);
+                else makeRunnable(task);
+            }
+        }
+    }
+
+    /* Write out the rest of the task's output and retire it, waiting in epoll while the fd is full */
+    void close(Task* const task) {
+        task->closing = true;
+        task->out.flush();
+        if (task->outputBackend.pending() != 0) return park(task, task->outputFd.get(), EPOLLOUT);
+        task->out.close();
+        done(task);
+    }
+
+    /* Wait in epoll for the fd, or straight back to the run queue if epoll can't watch it
+     * (regular files never block). */
+    void park(Task* const task, int const fd, std::uint32_t const events) {
+        epoll_event ev{};
+        ev.events = events | EPOLLONESHOT;
+        ev.data.ptr = task;
+        if (::epoll_ctl(epoll_.get(), EPOLL_CTL_MOD, fd, &ev) != 0
+            and ::epoll_ctl(epoll_.get(), EPOLL_CTL_ADD, fd, &ev) != 0)
+            makeRunnable(task);
+    }
+
+    void poll() {
+        epoll_event events[64];
+        try {
+            while (live_.load() != 0) {
+                auto const n = ::epoll_wait(epoll_.get(), events, static_cast<int>(std::size(events)), -1);
+                if (n < 0 and errno != EINTR) throwErrno("epoll_wait");
+                for (int i = 0; i < n; ++i) {
+                    if (events[i].data.ptr == nullptr) {
+                        char drained[64];
+                        while (::read(wakeup_[0], drained, sizeof drained) > 0) {}
+                    }
+                    else makeRunnable(static_cast<Task*>(events[i].data.ptr));
+                }
+            }
+        }
+        catch (...) {
+            /* Release the workers first: run() joins them while the exception unwinds */
+            stop();
+            throw;
+        }
+        stop();
+    }
+
+    void stop() {
+        std::lock_guard const lock{ mutex_ };
+        stopping_ = true;
+        runnableChanged_.notify_all();
+    }
+
+    void makeRunnable(Task* const task) {
+        std::lock_guard const lock{ mutex_ };
+        runnable_.push_back(task);
+        runnableChanged_.notify_one();
+    }
+
+    [[nodiscard]] auto take() -> Task* {
+        std::unique_lock lock{ mutex_ };
+        runnableChanged_.wait(lock, [&] { return stopping_ or not runnable_.empty(); });
+        if (runnable_.empty()) return nullptr;
+        auto* const task = runnable_.front();
+        runnable_.pop_front();
+        return task;
+    }
+
+    void done(Task* const task) {
+        task->out.discard(); /* Not to be flushed to whatever reuses the fd */
+        /* Let readers of a FIFO see end of file now rather than when every task is done */
+        task->outputFd = UniqueFd{};
+        task->inputFd = UniqueFd{};
+        if (--live_ == 0) {
+            char const wake = 0;
+            (void)::write(wakeup_[1], &wake, 1);
+        }
+    }
+
+    std::vector<std::unique_ptr<Task>> tasks_;
+    RunLimits limits_;
+    UniqueFd epoll_;
+    int wakeup_[2] = { -1, -1 };
+    std::mutex mutex_;
+    std::condition_variable runnableChanged_;
+    std::deque<Task*> runnable_;
+    bool stopping_ = false;
+    std::atomic<std::size_t> live_{ 0 };
+    std::atomic<std::size_t> failures_{ 0 };
+};
+
+/* One program per line: `<program> <input> <output>`; inputs and outputs are typically FIFOs or sockets. */
+[[nodiscard]] auto loadTasks(char const* const path, int const optimizationLevel) -> std::optional<std::vector<std::unique_ptr<Task>>> {
+    std::ifstream f{ path };
+    if (not f.is_open()) {
+        std::cerr << "Can't open the manifest " << path << '\n';
+        return std::nullopt;
+    }
+    std::vector<std::unique_ptr<Task>> tasks;
+    for (std::string line; std::getline(f, line);) {
+        std::istringstream fields{ line };
+        std::string programPath, inputPath, outputPath;
+        if (not (fields >> programPath) or programPath.starts_with('#')) continue;
+        if (not (fields >> inputPath >> outputPath)) {
+            std::cerr << "Expected '<program> <input> <output>': " << line << '\n';
+            return std::nullopt;
+        }
+        auto program = loadProgram(programPath.c_str(), optimizationLevel);
+        if (not program) return std::nullopt;
+        UniqueFd input{ ::open(inputPath.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC) };
+        /* O_RDWR: a nonblocking O_WRONLY open of a FIFO fails until somebody reads it */
+        UniqueFd output{ ::open(outputPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_NONBLOCK | O_CLOEXEC, 0666) };
+        if (not input or not output) {
+            std::cerr << "Can't open " << (input ? outputPath : inputPath) << '\n';
+            return std::nullopt;
+        }
+        tasks.push_back(std::make_unique<Task>(std::move(*program), std::move(input), std::move(output)));
+        tasks.back()->index = tasks.size() - 1;
+    }
+    return tasks;
+}
+
+[[nodiscard]] auto unixAddress(char const* const path) -> sockaddr_un {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (std::strlen(path) >= sizeof address.sun_path) throw std::invalid_argument("Socket path too long");
+    std::strcpy(address.sun_path, path);
+    return address;
+}
+
+[[nodiscard]] auto listenUnix(char const* const path) -> UniqueFd {
+    UniqueFd listener{ ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0) };
+    if (not listener) throwErrno("socket");
+    auto const address = unixAddress(path);
+    ::unlink(path);
+    if (::bind(listener.get(), reinterpret_cast<sockaddr const*>(&address), sizeof address) != 0) throwErrno(path);
+    if (::listen(listener.get(), SOMAXCONN) != 0) throwErrno("listen");
+    return listener;
+}
+
+[[nodiscard]] auto connectUnix(char const* const path) -> UniqueFd {
+    UniqueFd connection{ ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0) };
+    if (not connection) throwErrno("socket");
+    auto const address = unixAddress(path);
+    if (::connect(connection.get(), reinterpret_cast<sockaddr const*>(&address), sizeof address) != 0) throwErrno(path);
+    return connection;
+}
+
+/* Fork-server requests carry the child's stdin and stdout as SCM_RIGHTS */
+static void sendFds(int const socket, int const inputFd, int const outputFd) {
+    char byte = 0;
+    iovec iov{ &byte, 1 };
+    alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))]{};
+    msghdr message{};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof control;
+    auto* const header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(2 * sizeof(int));
+    int const fds[2] = { inputFd, outputFd };
+    std::memcpy(CMSG_DATA(header), fds, sizeof fds);
+    if (::sendmsg(socket, &message, MSG_NOSIGNAL) != 1) throwErrno("sendmsg");
+}
+
+[[nodiscard]] static auto receiveFds(int const socket) -> std::optional<std::pair<UniqueFd, UniqueFd>> {
+    char byte = 0;
+    iovec iov{ &byte, 1 };
+    alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))]{};
+    msghdr message{};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof control;
+    if (::recvmsg(socket, &message, MSG_CMSG_CLOEXEC) != 1) return std::nullopt;
+    auto* const header = CMSG_FIRSTHDR(&message);
+    if (header == nullptr or header->cmsg_type != SCM_RIGHTS or header->cmsg_len != CMSG_LEN(2 * sizeof(int)))
+        return std::nullopt;
+    int fds[2];
+    std::memcpy(fds, CMSG_DATA(header), sizeof fds);
+    return std::pair{ UniqueFd{ fds[0] }, UniqueFd{ fds[1] } };
+}
+
+/* AFL-style fork server: the program is parsed and optimized once, then every connection on
+ * `socketPath` sends the stdin/stdout to use and gets a fork of this process running the
+ * program on them. The reply is the child's wait status as an int. A `timeoutSeconds` above 0
+ * applies to each child on its own. */
+[[noreturn]] void runForkServer(char const* const socketPath, Program const& program, RunLimits const& limits,
+                               double const timeoutSeconds) {
+    auto const listener = listenUnix(socketPath);
+    std::cerr << "Fork server listening on " << socketPath << '\n';
+    for (;;) {
+        UniqueFd const connection{ ::accept4(listener.get(), nullptr, nullptr, SOCK_CLOEXEC) };
+        if (not connection) {
+            if (errno == EINTR or errno == ECONNABORTED) continue;
+            throwErrno("accept");
+        }
+        auto fds = receiveFds(connection.get());
+        if (not fds) continue;
+
+        auto const child = ::fork();
+        if (child < 0) throwErrno("fork");
+        if (child == 0) {
+            if (timeoutSeconds > 0) startTimeout(timeoutSeconds);
+            int status = EXIT_SUCCESS;
+            try {
+                FdInput inputBackend{ fds->first.get(), limits.interrupt };
+                FdOutput outputBackend{ fds->second.get() };
+                Output out{ outputBackend };
+                Input in{ inputBackend, &out };
+                auto const run = execute(program, out, in, limits);
+                out.close();
+                if (describeStop(run.status) != nullptr) status = EXIT_FAILURE;
+            }
+            catch (std::exception const& e) {
+                std::cerr << e.what() << '\n';
+                status = EXIT_FAILURE;
+            }
+            ::_exit(status); /* Skip the parent's atexit handlers and stream flushing */
+        }
+        fds.reset();
+        int status = 0;
+        while (::waitpid(child, &status, 0) < 0 and errno == EINTR) {}
+        (void)::send(connection.get(), &status, sizeof status, MSG_NOSIGNAL);
+    }
+}
+
+/* Launch one run through the fork server; returns the child's wait status. */
+[[nodiscard]] auto forkServerRequest(char const* const socketPath, int const inputFd, int const outputFd) -> int {
+    auto const connection = connectUnix(socketPath);
+    sendFds(connection.get(), inputFd, outputFd);
+    int status = 0;
+    if (::recv(connection.get(), &status, sizeof status, MSG_WAITALL) != sizeof status)
+        throw std::runtime_error("Fork server closed the connection");
+    return status;
+}
+
+/* With `repeat == 1`, run once on our own stdin/stdout and exit like the program did. Otherwise
+ * measure launch latency over `repeat` runs with /dev/null as input and output. */
+[[nodiscard]] auto runForkClient(char const* const socketPath, std::size_t const repeat) -> int {
+    if (repeat <= 1) {
+        auto const status = forkServerRequest(socketPath, STDIN_FILENO, STDOUT_FILENO);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+    }
+    UniqueFd const null{ ::open("/dev/null", O_RDWR | O_CLOEXEC) };
+    if (not null) throwErrno("/dev/null");
+    std::vector<double> latencies;
+    std::size_t failures = 0;
+    for (std::size_t i = 0; i != repeat; ++i) {
+        auto const start = std::chrono::steady_clock::now();
+        auto const status = forkServerRequest(socketPath, null.get(), null.get());
+        latencies.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        if (not WIFEXITED(status) or WEXITSTATUS(status) != 0) ++failures;
+    }
+    std::cerr << repeat << " launches, " << failures << " failed\n";
+    printLatencies(std::move(latencies));
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Least-recently-used cache of compiled programs, keyed by source hash. Entries keep their source,
+ * so a hash collision is a miss rather than the wrong program. Safe to share between threads. */
+class ProgramCache {
+public:
+    explicit ProgramCache(std::size_t const capacity) noexcept : capacity_{ std::max<std::size_t>(capacity, 1) } {}
+
+    /* The program compiled from `source`; without it, the one last sent with that hash */
+    [[nodiscard]] auto find(std::uint64_t const hash, std::optional<std::string_view> const source = std::nullopt)
+            -> std::shared_ptr<Program const> {
+        std::lock_guard const lock{ mutex_ };
+        auto const found = index_.find(hash);
+        if (found == index_.end() or (source and found->second->source != *source)) return nullptr;
+        entries_.splice(entries_.begin(), entries_, found->second);
+        return found->second->program;
+    }
+
+    /* A colliding source takes the hash over */
+    void insert(std::uint64_t const hash, std::string source, std::shared_ptr<Program const> program) {
+        std::lock_guard const lock{ mutex_ };
+        if (auto const found = index_.find(hash); found != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, found->second);
+            if (found->second->source != source) *found->second = { hash, std::move(source), std::move(program) };
+            return;
+        }
+        entries_.push_front({ hash, std::move(source), std::move(program) });
+        index_.emplace(hash, entries_.begin());
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.back().hash);
+            entries_.pop_back();
+        }
+    }
+
+private:
+    struct Entry {
+        std::uint64_t hash;
+        std::string source;
+        std::shared_ptr<Program const> program;
+    };
+
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::list<Entry> entries_; /* Most recently used first */
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> index_;
+};
+
+/* Daemon wire format, native byte order (the socket is local):
+ *   request:  u8 kind (0: source follows, 1: hash follows), then `u32 size + source` or `u64 hash`,
+ *             then u32 size + input; or just u8 2 to get statistics as the output
+ *   response: output as `u32 size + bytes` chunks, a u32 0, then u8 DaemonStatus, u64 hash, u64 steps */
+enum class DaemonStatus : std::uint8_t { Ok, UnknownHash, StepLimit, BadRequest, Error, TooLarge };
+
+/* What --daemon accepts from a client */
+struct DaemonLimits {
+    std::size_t maxSource; /* Bytes */
+    std::size_t maxInput;
+    double clientTimeoutSeconds; /* Longest wait for a client to send or take bytes */
+};
+
+[[nodiscard]] static auto readExact(int const fd, void* const data, std::size_t size) -> bool {
+    auto* bytes = static_cast<char*>(data);
+    while (size != 0) {
+        auto const got = ::read(fd, bytes, size);
+        if (got == 0) return false;
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += got;
+        size -= static_cast<std::size_t>(got);
+    }
+    return true;
+}
+
+template <typename T>
+[[nodiscard]] static auto readValue(int const fd) -> std::optional<T> {
+    T value;
+    if (not readExact(fd, &value, sizeof value)) return std::nullopt;
+    return value;
+}
+
+/* nullopt if the peer went away; throws std::length_error, before allocating, past `maxSize` */
+[[nodiscard]] static auto readSized(int const fd, std::size_t const maxSize) -> std::optional<std::string> {
+    auto const size = readValue<std::uint32_t>(fd);
+    if (not size) return std::nullopt;
+    if (*size > maxSize) throw std::length_error("Request too large");
+    std::string bytes(*size, '\0');
+    if (not readExact(fd, bytes.data(), bytes.size())) return std::nullopt;
+    return bytes;
+}
+
+template <typename T>
+static void writeValue(int const fd, T const value) {
+    writeAll(fd, reinterpret_cast<char const*>(&value), sizeof value);
+}
+
+/* Streams every flushed buffer to the client as a `u32 size + bytes` chunk */
+class ChunkedSocketOutput final : public OutputBackend {
+public:
+    explicit ChunkedSocketOutput(int const fd) : fd_{ fd }, buffer_(ioBufferSize) {}
+
+    auto flush(std::span<char> const data) -> std::span<char> override {
+        if (not data.empty()) {
+            writeValue(fd_, static_cast<std::uint32_t>(data.size()));
+            writeAll(fd_, data.data(), data.size());
+        }
+        return buffer_;
+    }
+
+private:
+    int fd_;
+    std::vector<char> buffer_;
+};
+
+/* Serve one request on `connection` */
+void serveDaemonRequest(int const connection, ProgramCache& cache, ResultCache* const results, int const optimizationLevel,
+                        RunLimits const& limits, DaemonLimits const& accepted) {
+    auto status = DaemonStatus::Ok;
+    std::uint64_t hash = 0;
+    std::size_t steps = 0;
+    auto const kind = readValue<std::uint8_t>(connection);
+    std::shared_ptr<Program const> program;
+    if (kind == 2) { /* Result-cache statistics, as text output */
+        try {
+            ChunkedSocketOutput outputBackend{ connection };
+            Output out{ outputBackend };
+            out.write(results != nullptr ? results->describe() : "result cache: off\n");
+            out.close();
+        }
+        catch (std::system_error const&) {
+            return;
+        }
+    }
+    else if (kind == 0) {
+        if (auto const source = readSized(connection, accepted.maxSource)) {
+            hash = hashBytes(*source);
+            if (not (program = cache.find(hash, *source))) {
+                try {
+                    program = std::make_shared<Program const>(compileProgram(*source, optimizationLevel));
+                    cache.insert(hash, *source, program);
+                }
+                catch (std::invalid_argument const&) {
+                    status = DaemonStatus::BadRequest;
+                }
+            }
+        }
+        else status = DaemonStatus::BadRequest;
+    }
+    else if (kind == 1) {
+        if (auto const requested = readValue<std::uint64_t>(connection)) {
+            hash = *requested;
+            if (not (program = cache.find(hash))) status = DaemonStatus::UnknownHash;
+        }
+        else status = DaemonStatus::BadRequest;
+    }
+    else status = DaemonStatus::BadRequest;
+
+    auto const input = kind == 2 ? std::optional<std::string>{ "" } : readSized(connection, accepted.maxInput);
+    if (not input) return; /* Client went away mid-request */
+
+    if (program != nullptr) {
+        try {
+            ChunkedSocketOutput outputBackend{ connection };
+            auto const run = executeMemoized(*program, *input, outputBackend, limits, results);
+            steps = run.steps;
+            if (run.status == Machine::Status::StepLimit) status = DaemonStatus::StepLimit;
+        }
+        catch (std::system_error const&) {
+            return; /* Client went away while we were streaming */
+        }
+        catch (std::exception const&) {
+            status = DaemonStatus::Error;
+        }
+    }
+    try {
+        writeValue(connection, std::uint32_t{ 0 });
+        writeValue(connection, status);
+        writeValue(connection, hash);
+        writeValue(connection, static_cast<std::uint64_t>(steps));
+    }
+    catch (std::system_error const&) {}
+}
+
+/* Serve one request, refusing one that is too large without reading the rest of it */
+void serveDaemonConnection(int const connection, ProgramCache& cache, ResultCache* const results, int const optimizationLevel,
+                           RunLimits const& limits, DaemonLimits const& accepted) {
+    try {
+        serveDaemonRequest(connection, cache, results, optimizationLevel, limits, accepted);
+    }
+    catch (std::length_error const&) {
+        try {
+            writeValue(connection, std::uint32_t{ 0 });
+            writeValue(connection, DaemonStatus::TooLarge);
+            writeValue(connection, std::uint64_t{ 0 });
+            writeValue(connection, std::uint64_t{ 0 });
+        }
+        catch (std::system_error const&) {}
+    }
+}
+
+/* Accept connections on `socketPath` forever, serving one request each on `workers` threads. */
+[[noreturn]] void runDaemon(char const* const socketPath, unsigned const workers, std::size_t const cacheSize,
+                            ResultCache* const results, int const optimizationLevel, RunLimits const& limits,
+                            DaemonLimits const& accepted) {
+    std::signal(SIGPIPE, SIG_IGN); /* A client hanging up must not kill the daemon */
+    auto const listener = listenUnix(socketPath);
+    ProgramCache cache{ cacheSize };
+    std::mutex mutex;
+    std::condition_variable pending;
+    std::deque<UniqueFd> connections;
+
+    std::vector<std::jthread> threads;
+    for (unsigned i = 0; i != std::max(workers, 1u); ++i) {
+        threads.emplace_back([&] {
+            for (;;) {
+                UniqueFd connection;
+                {
+                    std::unique_lock lock{ mutex };
+                    pending.wait(lock, [&] { return not connections.empty(); });
+                    connection = std::move(connections.front());
+                    connections.pop_front();
+                }
+                serveDaemonConnection(connection.get(), cache, results, optimizationLevel, limits, accepted);
+            }
+        });
+    }
+    std::cerr << "Daemon listening on " << socketPath << '\n';
+    auto const wholeSeconds = std::floor(accepted.clientTimeoutSeconds);
+    timeval const timeout{ static_cast<time_t>(wholeSeconds), static_cast<suseconds_t>((accepted.clientTimeoutSeconds - wholeSeconds) * 1e6) };
+    for (;;) {
+        UniqueFd connection{ ::accept4(listener.get(), nullptr, nullptr, SOCK_CLOEXEC) };
+        if (not connection) {
+            if (errno == EINTR or errno == ECONNABORTED) continue;
+            throwErrno("accept");
+        }
+        /* An idle client would hold a worker forever: reads give up as if it hung up, writes throw */
+        ::setsockopt(connection.get(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+        ::setsockopt(connection.get(), SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof timeout);
+        std::lock_guard const lock{ mutex };
+        connections.push_back(std::move(connection));
+        pending.notify_one();
+    }
+}
+
+struct DaemonReply {
+    DaemonStatus status = DaemonStatus::Error;
+    std::uint64_t hash = 0;
+    std::uint64_t steps = 0;
+};
+
+/* Output chunks up to the empty one, then the status trailer */
+template <typename Sink>
+[[nodiscard]] auto readDaemonReply(int const fd, Sink const& sink) -> DaemonReply {
+    std::string chunk;
+    for (;;) {
+        auto const size = readValue<std::uint32_t>(fd);
+        if (not size) throw std::runtime_error("Daemon closed the connection");
+        if (*size == 0) break;
+        chunk.resize(*size);
+        if (not readExact(fd, chunk.data(), chunk.size())) throw std::runtime_error("Daemon closed the connection");
+        sink(std::string_view{ chunk });
+    }
+    auto const status = readValue<DaemonStatus>(fd);
+    auto const replyHash = readValue<std::uint64_t>(fd);
+    auto const steps = readValue<std::uint64_t>(fd);
+    if (not status or not replyHash or not steps) throw std::runtime_error("Daemon closed the connection");
+    return { *status, *replyHash, *steps };
+}
+
+/* The request half of the wire format */
+void sendDaemonRequest(int const fd, std::string_view const source, std::optional<std::uint64_t> const hash, std::string_view const input) {
+    if (hash) {
+        writeValue(fd, std::uint8_t{ 1 });
+        writeValue(fd, *hash);
+    }
+    else {
+        writeValue(fd, std::uint8_t{ 0 });
+        writeValue(fd, static_cast<std::uint32_t>(source.size()));
+        writeAll(fd, source.data(), source.size());
+    }
+    writeValue(fd, static_cast<std::uint32_t>(input.size()));
+    writeAll(fd, input.data(), input.size());
+}
+
+/* One request; output chunks are passed to `sink` as they stream in. */
+template <typename Sink>
+[[nodiscard]] auto daemonRequest(char const* const socketPath, std::string_view const source, std::optional<std::uint64_t> const hash,
+                                 std::string_view const input, Sink const& sink) -> DaemonReply {
+    auto const connection = connectUnix(socketPath);
+    auto const fd = connection.get();
+    try {
+        sendDaemonRequest(fd, source, hash, input);
+    }
+    catch (std::system_error const& e) {
+        /* The daemon stops reading a request it refuses; its reply says why */
+        if (e.code() != std::errc::broken_pipe) throw;
+    }
+    return readDaemonReply(fd, sink);
+}
+
+/* Print the daemon's result-cache statistics */
+[[nodiscard]] auto runDaemonStats(char const* const socketPath) -> int {
+    auto const connection = connectUnix(socketPath);
+    writeValue(connection.get(), std::uint8_t{ 2 });
+    auto const reply = readDaemonReply(connection.get(), [](std::string_view const text) { std::cout << text; });
+    return reply.status == DaemonStatus::Ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* With `repeat == 1`, run the source once and print its output. Otherwise act as a load generator:
+ * `clients` threads send `repeat` requests in total (the source once, then its hash) and report
+ * latency percentiles and throughput. */
+[[nodiscard]] auto runDaemonClient(char const* const socketPath, char const* const sourcePath, char const* const inputPath,
+                                   std::size_t const repeat, unsigned const clients) -> int {
+    std::signal(SIGPIPE, SIG_IGN); /* A refused request shows up as EPIPE, then the daemon's reply */
+    auto const source = readWholeFile(sourcePath);
+    if (not source) {
+        std::cerr << "Can't open the source-code file " << sourcePath << '\n';
+        return EXIT_FAILURE;
+    }
+    std::string input;
+    if (inputPath != nullptr) {
+        auto contents = readWholeFile(inputPath);
+        if (not contents) {
+            std::cerr << "Can't open the input file\n";
+            return EXIT_FAILURE;
+        }
+        input = std::move(*contents);
+    }
+
+    if (repeat <= 1) {
+        FdOutput outputBackend{ STDOUT_FILENO };
+        Output out{ outputBackend };
+        auto const reply = daemonRequest(socketPath, *source, std::nullopt, input, [&](std::string_view const chunk) { out.write(chunk); });
+        out.close();
+        if (reply.status == DaemonStatus::Ok) return EXIT_SUCCESS;
+        constexpr char const* reasons[] = { "ok", "unknown program hash", "step-limit", "bad request", "error", "request too large" };
+        std::cerr << "Daemon: " << reasons[static_cast<std::size_t>(reply.status)] << '\n';
+        return EXIT_FAILURE;
+    }
+
+    /* Warm the cache and learn the hash */
+    auto const hash = daemonRequest(socketPath, *source, std::nullopt, input, [](std::string_view) {}).hash;
+    std::vector<std::vector<double>> latencies(std::max(clients, 1u));
+    std::atomic<std::size_t> failures{ 0 };
+    auto const start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t client = 0; client != latencies.size(); ++client) {
+            threads.emplace_back([&, client] {
+                for (auto i = client; i < repeat; i += latencies.size()) {
+                    auto const requestStart = std::chrono::steady_clock::now();
+                    try {
+                        if (daemonRequest(socketPath, {}, hash, input, [](std::string_view) {}).status != DaemonStatus::Ok) ++failures;
+                    }
+                    catch (std::exception const&) {
+                        ++failures;
+                    }
+                    latencies[client].push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - requestStart).count());
+                }
+            });
+        }
+    }
+    auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::vector<double> all;
+    for (auto const& perClient : latencies) all.insert(all.end(), perClient.begin(), perClient.end());
+    std::cerr << repeat << " requests, " << failures << " failed, " << static_cast<double>(repeat) / seconds << " requests/s\n";
+    printLatencies(std::move(all));
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#ifndef BF_FUZZER
+struct Options {
+    std::vector<char const*> sourcePaths; /* More than one only with --pipeline */
+    char const* inputPath = nullptr;  /* Program input; stdin if null */
+    char const* outputPath = nullptr; /* Program output; stdout if null */
+    IoMode io = IoMode::Sync;
+    int optimizationLevel = 1;
+    bool flushBeforeRead = true; /* Otherwise output is only flushed when the buffer is full */
+    bool pipeline = false;
+    std::size_t maxSteps = SIZE_MAX; /* Per program */
+    double timeoutSeconds = 0;       /* Wall clock for the whole run; 0 for none */
+    char const* batchManifest = nullptr;
+    char const* inputList = nullptr; /* Run the one source over every input listed here */
+    char const* multiplexManifest = nullptr;
+    char const* forkServerSocket = nullptr;
+    char const* forkClientSocket = nullptr;
+    std::optional<std::size_t> repeat; /* --fork-client launches, --daemon-client requests, --verify runs (default 1), --bench runs and --micro samples (default 5) */
+    std::size_t warmups = 1;           /* Untimed --bench runs */
+    char const* benchSuite = nullptr;
+    char const* recordPath = nullptr;  /* Benchmark history that --bench results are appended to */
+#ifdef BF_COMMIT
+    char const* commit = BF_COMMIT;    /* What --record tags the results with */
+#else
+    char const* commit = "unknown";
+#endif // BF_COMMIT
+    char const* comparePath = nullptr; /* Benchmark history to compare two runs of */
+    char const* baselineCommit = nullptr;
+    char const* candidateCommit = nullptr;
+    double alpha = 0.05;
+    std::optional<std::string_view> microFilter; /* Run the microbenchmarks whose names contain this */
+    bool verify = false; /* Compare every engine on the source file, or on every program of the directory */
+    std::optional<GeneratorSettings> generate; /* Write a random program instead of running one */
+    std::uint64_t seed = 1;
+    char const* daemonSocket = nullptr;
+    char const* daemonClientSocket = nullptr;
+    std::size_t cacheSize = 256; /* Compiled programs kept by --daemon */
+    DaemonLimits daemonLimits{ std::size_t{ 16 } << 20, std::size_t{ 256 } << 20, 30 }; /* Largest source and input it reads, idle timeout */
+    char const* daemonStatsSocket = nullptr;
+    std::size_t resultCacheMegabytes = 0; /* Memoized outputs for --batch, --inputs and --daemon; 0 for none */
+    char const* resultSpillDir = nullptr; /* Results evicted from memory go here */
+    char const* batchOutputDir = nullptr; /* Per-job output files; combined output if null */
+    unsigned jobs = std::max(std::thread::hardware_concurrency(), 1u);
+    bool profile = false; /* Annotated execution counts on stderr after a single run */
+    bool loopReport = false; /* Loop statistics on stderr after a single run */
+    bool jit = false;        /* Run a single program as native code */
+    bool perfMap = false;    /* Describe the JIT code in /tmp/perf-<pid>.map */
+    bool jitDump = false;    /* ... and/or in jit-<pid>.dump */
+    bool counters = false;   /* Hardware counters per phase on stderr after a single run */
+    char const* tapeStatsPrefix = nullptr; /* Tape usage CSVs after a single run */
+    char const* samplePath = nullptr;      /* Folded stacks from SIGPROF samples of a single run */
+    unsigned sampleHertz = 997;
+    bool metrics = false;                  /* JSON records for single and batch runs */
+    char const* metricsTarget = "fd:2";    /* A file, or `fd:<n>` */
+    char const* tracePath = nullptr;       /* Record a single run for --replay */
+    std::uint64_t checkpointInterval = std::uint64_t{ 1 } << 27; /* Steps between trace checkpoints */
+    char const* replayPath = nullptr;
+    std::uint64_t replayFrom = 0;
+    std::uint64_t replayTo = UINT64_MAX;
+};
+
+static void printUsage(char const* const self) {
+    std::cerr << "Usage: " << self << " [-O0|-O1] [--io=sync|uring] [--flush=before-read|when-full] [--max-steps=<n>] [--timeout=<seconds>] [--input=<file>] [--output=<file>] [--profile] [--loops] [--jit [--perf-map] [--jitdump]] [--counters] [--tape-stats=<prefix>] [--sample=<file> [--sample-hz=<n>]] [--metrics=json [--metrics-to=<file>|fd:<n>]] [--trace=<file> [--checkpoint-every=<steps>]] <source-file>\n"
+              << "       " << self << " [options] --replay=<trace> [--from=<step>] [--to=<step>] <source-file>\n"
+              << "       " << self << " [options] --pipeline <source-file>...\n"
+              << "       " << self << " [options] --batch=<manifest> [--jobs=<n>] [--batch-output=<dir>]\n"
+              << "       " << self << " [options] --inputs=<input-list> [--jobs=<n>] [--batch-output=<dir>] <source-file>\n"
+              << "       " << self << " [options] --multiplex=<manifest> [--jobs=<n>]\n"
+              << "       " << self << " [options] --fork-server=<socket> <source-file>\n"
+              << "       " << self << " --fork-client=<socket> [--repeat=<n>]\n"
+              << "       " << self << " [options] --daemon=<socket> [--jobs=<n>] [--cache-size=<programs>] [--max-source=<bytes>] [--max-input=<bytes>] [--client-timeout=<seconds>]\n"
+              << "       " << self << " --daemon-client=<socket> [--input=<file>] [--repeat=<n>] [--jobs=<n>] <source-file>\n"
+              << "       " << self << " --daemon-stats=<socket>\n"
+              << "       " << self << " --bench=<suite> [--warmup=<n>] [--repeat=<n>] [--record=<history> [--commit=<id>]]\n"
+              << "       " << self << " --compare=<history> [--baseline=<commit>] [--candidate=<commit>] [--alpha=<p>]\n"
+              << "       " << self << " --micro[=<filter>] [--repeat=<n>]\n"
+              << "       " << self << " --verify [--input=<file>] [--repeat=<n>] <source-file>|<directory>\n"
+              << "       " << self << " --generate=<bytes>[K|M|G] [--seed=<n>] [--loop-depth=<n>] [--idioms=<percent>] [--io-rate=<percent>] [--unbalanced] [--output=<file>]\n"
+              << "Batch and daemon modes also take [--result-cache=<MiB>] [--result-spill=<dir>].\n";
+}
+
+/* A byte count with an optional K, M or G suffix */
+[[nodiscard]] auto parseSize(char const* const text) -> std::uint64_t {
+    char* end = nullptr;
+    auto const value = std::strtoull(text, &end, 10);
+    switch (*end) {
+        case 'K': return value << 10;
+        case 'M': return value << 20;
+        case 'G': return value << 30;
+        default: return value;
+    }
+}
+
+[[nodiscard]] auto parseArguments(int const argc, char* const argv[]) -> std::optional<Options> {
+    Options options;
+    auto const generator = [&]() -> GeneratorSettings& { return options.generate ? *options.generate : options.generate.emplace(); };
+    for (int i = 1; i < argc; ++i) {
+        std::string_view const arg = argv[i];
+        if (arg == "--io=sync") options.io = IoMode::Sync;
+        else if (arg == "--io=uring") options.io = IoMode::Uring;
+        else if (arg.starts_with("--input=")) options.inputPath = argv[i] + std::size("--input=") - 1;
+        else if (arg.starts_with("--output=")) options.outputPath = argv[i] + std::size("--output=") - 1;
+        else if (arg == "--flush=before-read") options.flushBeforeRead = true;
+        else if (arg == "--flush=when-full") options.flushBeforeRead = false;
+        else if (arg == "--pipeline") options.pipeline = true;
+        else if (arg == "--profile") options.profile = true;
+        else if (arg == "--loops") options.loopReport = true;
+        else if (arg == "--jit") options.jit = true;
+        else if (arg == "--perf-map") options.perfMap = true;
+        else if (arg == "--jitdump") options.jitDump = true;
+        else if (arg == "--counters") options.counters = true;
+        else if (arg.starts_with("--sample=")) options.samplePath = argv[i] + std::size("--sample=") - 1;
+        else if (arg.starts_with("--sample-hz=")) options.sampleHertz = static_cast<unsigned>(std::strtoul(argv[i] + std::size("--sample-hz=") - 1, nullptr, 10));
+        else if (arg.starts_with("--trace=")) options.tracePath = argv[i] + std::size("--trace=") - 1;
+        else if (arg.starts_with("--checkpoint-every=")) options.checkpointInterval = std::max<std::uint64_t>(std::strtoull(argv[i] + std::size("--checkpoint-every=") - 1, nullptr, 10), 1);
+        else if (arg.starts_with("--replay=")) options.replayPath = argv[i] + std::size("--replay=") - 1;
+        else if (arg.starts_with("--from=")) options.replayFrom = std::strtoull(argv[i] + std::size("--from=") - 1, nullptr, 10);
+        else if (arg.starts_with("--to=")) options.replayTo = std::strtoull(argv[i] + std::size("--to=") - 1, nullptr, 10);
+        else if (arg == "--metrics=json") options.metrics = true;
+        else if (arg.starts_with("--metrics-to=")) options.metricsTarget = argv[i] + std::size("--metrics-to=") - 1;
+        else if (arg.starts_with("--tape-stats=")) options.tapeStatsPrefix = argv[i] + std::size("--tape-stats=") - 1;
+        else if (arg.starts_with("--batch=")) options.batchManifest = argv[i] + std::size("--batch=") - 1;
+        else if (arg.starts_with("--fork-server=")) options.forkServerSocket = argv[i] + std::size("--fork-server=") - 1;
+        else if (arg.starts_with("--fork-client=")) options.forkClientSocket = argv[i] + std::size("--fork-client=") - 1;
+        else if (arg.starts_with("--daemon=")) options.daemonSocket = argv[i] + std::size("--daemon=") - 1;
+        else if (arg.starts_with("--daemon-client=")) options.daemonClientSocket = argv[i] + std::size("--daemon-client=") - 1;
+        else if (arg.starts_with("--daemon-stats=")) options.daemonStatsSocket = argv[i] + std::size("--daemon-stats=") - 1;
+        else if (arg.starts_with("--result-cache=")) options.resultCacheMegabytes = std::strtoull(argv[i] + std::size("--result-cache=") - 1, nullptr, 10);
+        else if (arg.starts_with("--result-spill=")) options.resultSpillDir = argv[i] + std::size("--result-spill=") - 1;
+        else if (arg.starts_with("--cache-size=")) options.cacheSize = std::strtoull(argv[i] + std::size("--cache-size=") - 1, nullptr, 10);
+        else if (arg.starts_with("--max-source=")) options.daemonLimits.maxSource = parseSize(argv[i] + std::size("--max-source=") - 1);
+        else if (arg.starts_with("--max-input=")) options.daemonLimits.maxInput = parseSize(argv[i] + std::size("--max-input=") - 1);
+        else if (arg.starts_with("--client-timeout=")) options.daemonLimits.clientTimeoutSeconds = std::strtod(argv[i] + std::size("--client-timeout=") - 1, nullptr);
+        else if (arg.starts_with("--bench=")) options.benchSuite = argv[i] + std::size("--bench=") - 1;
+        else if (arg == "--verify") options.verify = true;
+        else if (arg.starts_with("--generate=")) generator().bytes = parseSize(argv[i] + std::size("--generate=") - 1);
+        else if (arg.starts_with("--seed=")) options.seed = std::strtoull(argv[i] + std::size("--seed=") - 1, nullptr, 10);
+        else if (arg.starts_with("--loop-depth=")) generator().loopDepth = static_cast<unsigned>(std::strtoul(argv[i] + std::size("--loop-depth=") - 1, nullptr, 10));
+        else if (arg.starts_with("--idioms=")) generator().idiomPercent = std::min(static_cast<unsigned>(std::strtoul(argv[i] + std::size("--idioms=") - 1, nullptr, 10)), 100u);
+        else if (arg.starts_with("--io-rate=")) generator().ioPercent = std::min(static_cast<unsigned>(std::strtoul(argv[i] + std::size("--io-rate=") - 1, nullptr, 10)), 100u);
+        else if (arg == "--unbalanced") generator().unbalanced = true;
+        else if (arg == "--micro") options.microFilter = "";
+        else if (arg.starts_with("--micro=")) options.microFilter = arg.substr(std::size("--micro=") - 1);
+        else if (arg.starts_with("--record=")) options.recordPath = argv[i] + std::size("--record=") - 1;
+        else if (arg.starts_with("--commit=")) options.commit = argv[i] + std::size("--commit=") - 1;
+        else if (arg.starts_with("--compare=")) options.comparePath = argv[i] + std::size("--compare=") - 1;
+        else if (arg.starts_with("--baseline=")) options.baselineCommit = argv[i] + std::size("--baseline=") - 1;
+        else if (arg.starts_with("--candidate=")) options.candidateCommit = argv[i] + std::size("--candidate=") - 1;
+        else if (arg.starts_with("--alpha=")) options.alpha = std::strtod(argv[i] + std::size("--alpha=") - 1, nullptr);
+        else if (arg.starts_with("--warmup=")) options.warmups = std::strtoull(argv[i] + std::size("--warmup=") - 1, nullptr, 10);
+        else if (arg.starts_with("--repeat=")) options.repeat = std::strtoull(argv[i] + std::size("--repeat=") - 1, nullptr, 10);
+        else if (arg.starts_with("--multiplex=")) options.multiplexManifest = argv[i] + std::size("--multiplex=") - 1;
+        else if (arg.starts_with("--inputs=")) options.inputList = argv[i] + std::size("--inputs=") - 1;
+        else if (arg.starts_with("--batch-output=")) options.batchOutputDir = argv[i] + std::size("--batch-output=") - 1;
+        else if (arg.starts_with("--jobs=")) {
+            auto const jobs = parseCount(arg.substr(std::size("--jobs=") - 1));
+            if (not jobs) {
+                std::cerr << "Bad job count " << arg << '\n';
+                return std::nullopt;
+            }
+            options.jobs = static_cast<unsigned>(std::max(*jobs, 1));
+        }
+        else if (arg.starts_with("--max-steps=")) options.maxSteps = std::strtoull(argv[i] + std::size("--max-steps=") - 1, nullptr, 10);
+        else if (arg.starts_with("--timeout=")) options.timeoutSeconds = std::strtod(argv[i] + std::size("--timeout=") - 1, nullptr);
+        else if (arg == "-O0") options.optimizationLevel = 0;
+        else if (arg == "-O1") options.optimizationLevel = 1;
+        else if (arg.starts_with("-")) {
+            std::cerr << "Unknown option " << arg << '\n';
+            return std::nullopt;
+        }
+        else options.sourcePaths.push_back(argv[i]);
+    }
+    if (options.sourcePaths.empty() and options.batchManifest == nullptr and options.benchSuite == nullptr and options.comparePath == nullptr and not options.microFilter and not options.generate and options.multiplexManifest == nullptr
+        and options.forkClientSocket == nullptr and options.daemonSocket == nullptr and options.daemonStatsSocket == nullptr) {
+        std::cerr << "Source-code file name needed\n";
+        return std::nullopt;
+    }
+    if (options.sourcePaths.size() > 1 and not options.pipeline) {
+        std::cerr << "Only one source-code file expected\n";
+        return std::nullopt;
+    }
+    return options;
+}
+
+int main(int const argc, char* const argv[]) try {
+    auto const options = parseArguments(argc, argv);
+    if (not options) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (options->forkClientSocket != nullptr) return runForkClient(options->forkClientSocket, options->repeat.value_or(1));
+    if (options->daemonStatsSocket != nullptr) return runDaemonStats(options->daemonStatsSocket);
+    if (options->benchSuite != nullptr) {
+        auto const workloads = readSuite(options->benchSuite);
+        if (not workloads) return EXIT_FAILURE;
+        auto const results = runBenchmarks(*workloads, options->warmups, std::max<std::size_t>(options->repeat.value_or(5), 1));
+        printBenchResults(std::cout, results);
+        if (options->recordPath != nullptr) appendHistory(options->recordPath, results, options->commit, describeMachine());
+        return std::all_of(results.begin(), results.end(), [](BenchResult const& r) { return r.outputMatches; }) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if (options->comparePath != nullptr) {
+        auto const entries = readHistory(options->comparePath);
+        if (not entries) return EXIT_FAILURE;
+        return compareHistory(*entries, options->baselineCommit, options->candidateCommit, options->alpha, std::cout) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if (options->verify) {
+        auto const input = options->inputPath != nullptr ? readWholeFile(options->inputPath) : std::optional<std::string>{ "" };
+        if (not input) {
+            std::cerr << "Can't read the input file\n";
+            return EXIT_FAILURE;
+        }
+        auto const programs = listPrograms(options->sourcePaths.front());
+        return verifyPrograms(programs, *input, std::max<std::size_t>(options->repeat.value_or(1), 1), std::cout) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if (options->microFilter) {
+        runMicroBenchmarks(std::cout, *options->microFilter, std::max<std::size_t>(options->repeat.value_or(5), 1));
+        return EXIT_SUCCESS;
+    }
+
+    RunLimits limits;
+    limits.maxSteps = options->maxSteps;
+    if (options->timeoutSeconds > 0) {
+        limits.interrupt = &timerExpired;
+        /* The fork server times each child from its fork instead */
+        if (options->forkServerSocket == nullptr) startTimeout(options->timeoutSeconds);
+    }
+
+    std::optional<ResultCache> resultCache;
+    if (options->resultCacheMegabytes > 0 or options->resultSpillDir != nullptr)
+        resultCache.emplace(options->resultCacheMegabytes << 20, options->resultSpillDir);
+    auto* const results = resultCache ? &*resultCache : nullptr;
+
+    if (options->daemonClientSocket != nullptr)
+        return runDaemonClient(options->daemonClientSocket, options->sourcePaths.front(), options->inputPath, options->repeat.value_or(1), options->jobs);
+    /* Per-request limits only: a timeout would stop every request the daemon ever serves. */
+    if (options->daemonSocket != nullptr)
+        runDaemon(options->daemonSocket, options->jobs, options->cacheSize, results, options->optimizationLevel, RunLimits{ options->maxSteps, nullptr },
+                  options->daemonLimits);
+
+    if (options->multiplexManifest != nullptr) {
+        auto tasks = loadTasks(options->multiplexManifest, options->optimizationLevel);
+        if (not tasks) return EXIT_FAILURE;
+        Scheduler scheduler{ std::move(*tasks), limits };
+        return scheduler.run(options->jobs) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::unique_ptr<MetricsSink> metrics;
+    if (options->metrics and not (metrics = MetricsSink::open(options->metricsTarget))) return EXIT_FAILURE;
+    limits.countSteps = metrics != nullptr; /* The records report them */
+
+    /* Counters cover the single-run path only; other modes interleave many programs. The metrics
+     * need the phase times even without them. */
+    std::optional<PerfCounters> counters;
+    if (options->counters or metrics) {
+        counters.emplace(options->counters);
+        if (options->counters and not counters->available())
+            std::cerr << "Hardware counters unavailable (see /proc/sys/kernel/perf_event_paranoid)\n";
+    }
+
+    std::vector<Program> sources;
+    for (auto const* const path : options->sourcePaths) {
+        auto program = loadProgram(path, options->optimizationLevel, counters ? &*counters : nullptr);
+        if (not program) return EXIT_FAILURE;
+        sources.push_back(std::move(*program));
+    }
+
+    if (options->forkServerSocket != nullptr) runForkServer(options->forkServerSocket, sources.front(), limits, options->timeoutSeconds);
+
+    UniqueFd inputFile, outputFile;
+    std::unique_ptr<InputBackend> inputBackend;
+    std::unique_ptr<OutputBackend> outputBackend;
+    if (options->inputPath != nullptr) {
+        inputFile = UniqueFd{ ::open(options->inputPath, O_RDONLY | O_CLOEXEC) };
+        if (not inputFile) {
+            std::cerr << "Can't open the input file\n";
+            return EXIT_FAILURE;
+        }
+        inputBackend = MmapInput::create(inputFile.get());
+    }
+    if (options->outputPath != nullptr) {
+        outputFile = UniqueFd{ ::open(options->outputPath, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666) };
+        if (not outputFile) {
+            std::cerr << "Can't open the output file\n";
+            return EXIT_FAILURE;
+        }
+        outputBackend = MmapOutput::create(outputFile.get());
+    }
+    /* Pipes, terminals and anything else that can't be mapped. */
+    if (not inputBackend) inputBackend = makeInputBackend(options->io, inputFile ? inputFile.get() : STDIN_FILENO, limits.interrupt);
+    if (not outputBackend) outputBackend = makeOutputBackend(options->io, outputFile ? outputFile.get() : STDOUT_FILENO);
+
+    if (options->generate) {
+        Output out{ *outputBackend };
+        generateProgram(*options->generate, options->seed, out);
+        out.close();
+        return EXIT_SUCCESS;
+    }
+
+    if (options->batchManifest != nullptr or options->inputList != nullptr) {
+        auto const jobs = options->batchManifest != nullptr ? readManifest(options->batchManifest)
+                                                            : readInputList(options->inputList);
+        if (not jobs) return EXIT_FAILURE;
+        BatchSettings settings;
+        settings.workers = options->jobs;
+        settings.optimizationLevel = options->optimizationLevel;
+        settings.outputDir = options->batchOutputDir;
+        settings.limits = limits;
+        settings.resultCache = results;
+        settings.metrics = metrics.get();
+        if (options->batchManifest == nullptr) settings.sharedProgram = &sources.front();
+        Output out{ *outputBackend };
+        auto const ok = runBatch(*jobs, settings, out);
+        out.close();
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if (sources.size() > 1) return runPipeline(sources, *inputBackend, *outputBackend, options->flushBeforeRead, limits) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    Output out{ *outputBackend };
+    if (options->replayPath != nullptr) {
+        auto const ok = replay(options->replayPath, sources.front(), readWholeFile(options->sourcePaths.front()).value_or(""),
+                               options->replayFrom, options->replayTo, out, std::cerr);
+        out.close();
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    std::optional<trace::Writer> traceWriter;
+    std::optional<trace::RecordingInput> recordingInput;
+    if (options->tracePath != nullptr) recordingInput.emplace(*inputBackend, traceWriter.emplace(options->tracePath, sources.front().fingerprint));
+    Input in{ recordingInput ? static_cast<InputBackend&>(*recordingInput) : *inputBackend, options->flushBeforeRead ? &out : nullptr };
+    std::optional<SamplingProfiler> sampler;
+    auto const writeSamples = [&](std::function<std::optional<std::size_t>(std::uintptr_t)> const& commandAt) {
+        std::ofstream file{ options->samplePath };
+        if (not file) throw std::runtime_error(std::string{ "Can't write the samples to " } + options->samplePath);
+        writeFoldedStacks(file, sampler->samples(), readWholeFile(options->sourcePaths.front()).value_or(""), sources.front(),
+                          options->sourcePaths.front(), commandAt);
+        std::cerr << "Samples: " << sampler->samples().size() << " (" << sampler->dropped() << " dropped) written to " << options->samplePath << '\n';
+    };
+    if (options->jit) {
+#ifdef BF_HAVE_JIT
+        if (options->maxSteps == SIZE_MAX and options->timeoutSeconds <= 0 and not options->profile and not options->loopReport
+            and options->tapeStatsPrefix == nullptr and options->tracePath == nullptr) {
+            JitProgram const jit{ sources.front() };
+            if (options->perfMap or options->jitDump) {
+                auto const source = readWholeFile(options->sourcePaths.front()).value_or("");
+                if (options->perfMap) writePerfMap(jit, source, sources.front(), options->sourcePaths.front());
+                if (options->jitDump) writeJitDump(jit, source, sources.front(), options->sourcePaths.front());
+            }
+            if (options->samplePath != nullptr) sampler.emplace(true).start(options->sampleHertz);
+            if (counters) counters->measure("execute", [&] { jit.run(out, in); });
+            else jit.run(out, in);
+            out.close();
+            if (metrics) {
+                RunMetrics record;
+                describeCompile(record, sources.front(), &*counters, options->optimizationLevel);
+                record.engine = "jit";
+                record.executeSeconds = counters->seconds("execute").value_or(0);
+                record.bytesIn = in.bytesRead();
+                record.bytesOut = out.bytesWritten();
+                metrics->write(record);
+            }
+            if (sampler) {
+                sampler->stop();
+                writeSamples([&](std::uintptr_t const address) { return jit.commandAt(address); });
+            }
+            if (counters and counters->available()) printCounters(std::cerr, *counters, std::nullopt);
+            return EXIT_SUCCESS;
+        }
+        std::cerr << "--jit ignored: step limits, timeouts, traces and reports need the interpreter\n";
+#else
+        std::cerr << "--jit ignored: only available on x86-64 Linux\n";
+#endif // BF_HAVE_JIT
+    }
+    Instruments instruments;
+    if (options->profile) instruments.counts.emplace(sources.front());
+    if (options->loopReport) instruments.loops.emplace(sources.front());
+    if (options->tapeStatsPrefix != nullptr) instruments.tape.emplace(sources.front());
+    if (options->samplePath != nullptr) {
+        instruments.sampler = &sampler.emplace(false);
+        sampler->start(options->sampleHertz);
+    }
+    Execution run{};
+    auto const executeOnce = [&] {
+        if (traceWriter) run = executeTraced(sources.front(), out, in, limits, *traceWriter, options->checkpointInterval);
+        else if (instruments.any()) run = execute(sources.front(), out, in, limits, instruments);
+        else if (sampler) run = execute(sources.front(), out, in, limits, sampler->probe());
+        else run = execute(sources.front(), out, in, limits);
+    };
+    if (counters) counters->measure("execute", executeOnce);
+    else executeOnce();
+    out.close();
+    if (counters and counters->available()) printCounters(std::cerr, *counters, limits.active() ? std::optional{ run.steps } : std::nullopt);
+    if (metrics) {
+        RunMetrics record;
+        describeCompile(record, sources.front(), &*counters, options->optimizationLevel);
+        if (auto const stop = describeStop(run.status)) record.status = stop;
+        record.executeSeconds = counters->seconds("execute").value_or(0);
+        record.steps = run.steps;
+        record.tapeCells = run.tapeCells;
+        record.bytesIn = in.bytesRead();
+        record.bytesOut = out.bytesWritten();
+        metrics->write(record);
+    }
+    if (sampler) {
+        sampler->stop();
+        writeSamples([&](std::uintptr_t const pc) { return pc < sources.front().code.size() ? std::optional{ pc } : std::nullopt; });
+    }
+    if (instruments.tape) instruments.tape->report(std::cerr, options->tapeStatsPrefix);
+    if (instruments.counts or instruments.loops) {
+        if (auto const source = readWholeFile(options->sourcePaths.front())) {
+            if (instruments.counts) printProfile(std::cerr, *source, sources.front(), instruments.counts->counts, ::isatty(STDERR_FILENO) == 1);
+            if (instruments.loops) printLoopReport(std::cerr, *source, sources.front(), *instruments.loops);
+        }
+    }
+    auto const stop = describeStop(run.status);
+    if (stop != nullptr) std::cerr << "Stopped (" << stop << ")\n";
+    if (options->maxSteps != SIZE_MAX or options->timeoutSeconds > 0)
+        std::cerr << "Instructions executed: " << run.steps << '\n';
+    return stop == nullptr ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+catch (std::exception const& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+}
+#endif // BF_FUZZER
@@ -0,0 +1,48 @@
+Brainfuck interpreter in Brainfuck
+Input is a program then an exclamation mark then the program input
+Each instruction and cell takes an 11 cell slot; scan loops walk between them
+
+>>>>>>>>>>>>>>>>>>>>>[-]+[<<<<<<<<<,>>>>>>>[-]+<<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<
+<<<+>>>>>]>-------------------------------------------[>[-]<[-]]>[->[-]+<][-]+<<
+<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>--------------------------------------
+-------[>[-]<[-]]>[->[-]++<][-]+<<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>----
+----------------------------------------------------------[>[-]<[-]]>[->[-]+++<]
+[-]+<<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>--------------------------------
+----------------------------[>[-]<[-]]>[->[-]++++<][-]+<<<<<<<[->>>>>>+<+<<<<<]>
+>>>>[-<<<<<+>>>>>]>----------------------------------------------[>[-]<[-]]>[->[
+-]+++++<][-]+<<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>-----------------------
+---------------------[>[-]<[-]]>[->[-]++++++<][-]+<<<<<<<[->>>>>>+<+<<<<<]>>>>>[
+-<<<<<+>>>>>]>------------------------------------------------------------------
+-------------------------[>[-]<[-]]>[->[-]+++++++<][-]+<<<<<<<[->>>>>>+<+<<<<<]>
+>>>>[-<<<<<+>>>>>]>-------------------------------------------------------------
+--------------------------------[>[-]<[-]]>[->[-]++++++++<][-]+<<<<<<<[->>>>>>+<
++<<<<<]>>>>>[-<<<<<+>>>>>]>---------------------------------[>[-]<[-]]+<<<<<<[->
+>>>>+<+<<<<]>>>>[-<<<<+>>>>]>[>-<[-]]>[>[-]+<-]<<<<<<[-]>>>>>>>[[-]>>[-]<<]>[-<<
+<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[[-]<<<<<<<<[-
+]+>>>>>>>>>>[->>>>>>>>>>>+<<<<<<<<<<<]>[-]>>>>>>>>]>>]<<<<<<<<<<[-]+>>>>>>>>>>>[
+-]<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>>>>[-]>[->>>>>>>>>+<<+<<<<<<<]>>>>>>>[-<<<<<<<
++>>>>>>>]>>[<<<<<<<<[-]+>>>>>>>>[-]]<<<<<<<<[[-]>>>>>>>>[-]+<<<<<<<<<[->>>>>>>+>
++<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<-[>>[-]<<[-]]>>[->[>>>>>>>>>>>]>+<<<<<<<<
+<<<<[<<<<<<<<<<<]>>>>>>>>>>][-]+<<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<
++>>>>>>>>]<--[>>[-]<<[-]]>>[->[>>>>>>>>>>>]>-<<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>>>
+][-]+<<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<---[>>[-]<<[-]]>
+>[->[>>>>>>>>>>>][-]+>>>>>>>>>>>[-]<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>>>][-]+<<<<<<
+<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<----[>>[-]<<[-]]>>[->[>>>>>
+>>>>>>]<<<<<<<<<<<[-]<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>>>][-]+<<<<<<<<<[->>>>>>>+>
++<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<-----[>>[-]<<[-]]>>[->[>>>>>>>>>>>]>.<<<<
+<<<<<<<<[<<<<<<<<<<<]>>>>>>>>>>][-]+<<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<
+<<<<+>>>>>>>>]<------[>>[-]<<[-]]>>[->[>>>>>>>>>>>]>,<<<<<<<<<<<<[<<<<<<<<<<<]>>
+>>>>>>>>][-]+<<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<-------[
+>>[-]<<[-]]>>[->[>>>>>>>>>>>]>[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>[>>[-]+<<[-]]
+>>[-<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>[-]+>>>[>>>>>>>>>>>]>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>>[-]+<[-<+<+>>]<<[->>+<<]>[>>[-]<<[-]]>[-]>[
+-<<[-]+[[->>>>>>>>>>>+<<<<<<<<<<<]<<<<<<<[-]+>>>>>>>>>>>[-]>>>>>>[-]+<<<<<[->>>>
++<+<<<]>>>[-<<<+>>>]>-------[>[-]<[-]]>[->+<][-]+<<<<<[->>>>+<+<<<]>>>[-<<<+>>>]
+>--------[>[-]<[-]]>[->-<]>]>>]>][-]+<<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>>]<--------[>>[-]<<[-]]>>[->[>>>>>>>>>>>]>[->>>>>>+<+<<<<<]>>>>>[-<
+<<<<+>>>>>]>[>>[-]+<<[-]]>>[-<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>[-]+>>>[>>
+>>>>>>>>>]>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<]>>>>>>>>[->[-]+[[-<<<<<<<<<
+<<+>>>>>>>>>>>]<<<<<<<<<[-]+<<<<<<<<<<<[-]>>>>>>>[-]+<<<<<<[->>>>>+<+<<<<]>>>>[-
+<<<<+>>>>]>--------[>[-]<[-]]>[->>+<<][-]+<<<<<<[->>>>>+<+<<<<]>>>>[-<<<<+>>>>]>
+-------[>[-]<[-]]>[->>-<<]>>]<]>>]<<<<<<<<<<[-]+>>>>>>>>>>>[-]>[->>>>>>>>>+<<+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[<<<<<<<<[-]+>>>>>>>>[-]]<<<<<<<<]
@@ -0,0 +1,1156 @@
+Prime factors of the 16 bit numbers on its input; one number per line
+Trial division with 8 bit divisors built from nested divmod loops
+
+[-]+[>[-],>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>----------[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<.-----------------------------------------------
+->>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-<+<+>>]<<
+[->>+<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-<+<+>>]<<[->>+<<]>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>-]>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-<+<+>>]<<[->>+<<]>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>-<
+[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>-]>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-<+<+>>]<<[->>+<<]>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-
+]>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-<+<+>>]<<[->>+<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>]>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+>>]<<[->>+<<]>[-<+<+>>]<<[->>+<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>]>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<
+[->>+<<]>[-<+<+>>]<<[->>+<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>]>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[
+-<+<+>>]<<[->>+<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>]>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-<+<+>>]<<
+[->>+<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>]>[>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>]>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>]<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>>-<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-],>[-]+<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<----------[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<]<<<<<<<<<<[-]<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]++>>>>>>[-]+<<[-]>>>[-]+[<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->-[>+>>]>[+[-
+<+>]>+>>]<<<<<]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>+>]<[-]<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>
+]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<
+<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<
+[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[
+->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>->>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>
+>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<
+<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<
+[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->
+>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]
+>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->
+>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<
+<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<
+<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>
+>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<<<<<<<<<<<<<<<<
+<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<
+[-]>[-]>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<
+<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<
+<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]+++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>
++>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[
+-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<[-
+>>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]
+<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<
+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>->[-]]<
+[<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]
+>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>->>>>>>>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>
+>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+
+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]+++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>
++<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>
+>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[
+-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+
+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-
+]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>
+[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<
+[-]>>[-]<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>
+>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<
+<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+
+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+-<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>
+>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>
+>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<
+<<+>>>>>>>>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<<<<<<
+<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<
++>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-
+]<<<<<<<<<[-]>[-]>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+
+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>
+>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>
+>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]+++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>
+>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<
+[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[
+>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>
+>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]>->[-]]<[<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>->>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<
+<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>
+>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]+++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<
+]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[
+-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]
+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>
+>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>
+>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-
+]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>
+>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]
+]<<<<<<<<<[-]>>[-]<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<
+<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<
++>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<
+[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<
++<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<
+[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>
+>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>->[-]]<[<<<<<<<<[
+-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[
+-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+
+>>]<<[->>+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<
+<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<
+]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]+<<[->>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<
+<<[-]>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<]>>
+>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[>+++
++++++++++++++++++++++++++++++.[-]>>>>[-]++++++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]>[->>>>>+<<<<<<+>]<[->+<]>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<
+<]<<<<<<<<[-]>[-]>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[-<<<<<<<<<+>>>>>>>>+>]<[-
+]<<<<<[-][-]++++++++++<<<<[->>>>>>>>+<<<<<+<<<]>>>[-<<<+>>>]>[->>>>>+<<<<<<+>]<[
+->+<]>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<[-]<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<+>
+>>>>]<[-<<<<<<<<<<<<<+>>>>>>>>>>>>+>]<[-]<<<<<[-]<<<<[-]>>>>>>[-<+<+>>]<<[->>+<<
+]>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<[>>+++++++++++++++
++++++++++++++++++++++++++++++++++.<<[-]]>>[-]<<<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>
+>>[-<<<<<<<+>>>>>>>]>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<
+<[<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>[-]]<<<<<<<[-]>
+>>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]>[-]>>[-<<<+>>>]>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>->[-]]<
+[<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<[->>[-<+<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<
+<<<<]>>>>>>>>>[>-<[-]]<]<<<<<<[-]>>>>>>>>[<<<<<<<<[-]+>>>>>>>>[-]]+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[>>-<<[-]]>>[<<<<<<<<[->>>>>>+>+<<<<<<
+<]>>>>>>>[-<<<<<<<+>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]]>>-]<<<<<<<<[-][-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>]>>+[<<<<<<<<[-]>>>>>>>>[-]]<<<<<<<<[->>>>>>>>+<<+<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]
+<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>]<<<<<<<<<<<<<<<<<<<<<<[-]++<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<
+<<<<<<<<<<<<[-]<[->>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<
+<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-]+<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<-[<[-]>[-]]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<[<[
+-]>[-]]+<[->>>>>>>>>+<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[<<<<<<<<->>>>>>>>[-]
+]<<<<<<<<[>>>>>>>>++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]++++++++++<<<<<<[->>>>>>>+<<<+<<<<]>>>>[-<<<<+>>>
+>]>>[->>+<<<<+>>]<<[->>+<<]>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<<<<<<[-]>>>>>>[-]
+>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[-
+>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>][-]++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->
+>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<
+<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<<[->>>>-<+<<
+<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>
+>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+
+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>
+>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>>>>>>>>>++<<
+<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<->>>>>>>>>
+>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[-]<<<[->>>+>
+>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>>->>>>
+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>
+>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<
+<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<[-
+]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[
+->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<
+<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<<[->>>>-<+
+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>
+>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->
+>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>
+>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>>>>>>>>>++
+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<->>>>>>>
+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[-]<<<[->>>
++>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>>->>
+>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>
+>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<
+<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<
+[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]
+>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-
+<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[
+-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<<[->>>>-
+<+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>
+>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[
+->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[-
+>>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>>>>>>>>>
+++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<->>>>>
+>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[-]<<<[->
+>>+>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>>-
+>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[-]+>[->>
+>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<
+<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<
+<<[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<
+<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>
+[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>
+>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<<[->>>
+>-<+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+
+>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<
+<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<
+[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>>>>>>>
+>>++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<->>>
+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[-]<<<[
+->>>+>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>
+>->>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[-]+>[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<
+<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<
+<<<<[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<
+<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>
+>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]
+>>>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<<[->
+>>>-<+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<
+<+>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>
+]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<
+<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>>>>>
+>>>>++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<->
+>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[-]<<
+<[->>>+>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->
+>>>->>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[-]+>
+[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]
+]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<
+<<<<<<[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+
+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>
+>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<
+<]>>>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<<[
+->>>>-<+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<
+<<<+>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+
+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<
+<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>>>
+>>>>>>++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<<
+->>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[-]
+<<<[->>>+>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[
+->>>>->>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[-]
++>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[
+-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<
+<<<<<<<<[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>
+>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-
+]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+
+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]<<
+<[->>>>-<+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<<<<+>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+
+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<
+<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->>>
+>>>>>>>>++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<
+<<->>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]>[
+-]<<<[->>>+>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<
+<[->>>>->>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[
+-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>
+>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<
+<<<<<<<<<<[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[
+-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>
+>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>
+[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>
+>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<<<[->>>+<+<<]>>[-<<+>>]
+<<<[->>>>-<+<<<]>>>[-<<<+>>>]<<<[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<
+<<<<<<<+>>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-
+<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<
+<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<<[->
+>>>>>>>>>>++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>->[-]]<[<<<<<<<<[-
+<<<<->>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<<+>>>+>>]<<[->>+<<]
+>[-]<<<[->>>+>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<
+<<<[->>>>->>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<
+<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>
+>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[
+<<<<<<<<<<<<[-]<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]>
+>[-]<<<<<<<<<<<<[-]<<[-]>[->+<]<<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>[->>>>>>>>
+>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>+<<<+<<]>>[-<<+>>]>>[->-[>+>
+>]>[+[-<+>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>>>>>>>[-]>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>]<[-<<<+>>+>]<[-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>>>>>>>>>>>>>>+<<<<+<<
+<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>][-]++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<
+<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]
+<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-
+<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<
+<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>
+>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>
+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]
+<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]
+<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[
+-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<
+<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<
++>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+
+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++
+<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->
+>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+
+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[
+-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>
+>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<
+<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<
+<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>
+>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>
++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<
+<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]
+<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-
+<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<
+<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>
+>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>
+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]
+<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]
+<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[
+-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<
+<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<
++>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+
+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++
+<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->
+>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+
+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[
+-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>
+>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<
+<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<
+<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>
+>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>
++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<
+<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]
+<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-
+<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<
+<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>
+>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>
+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]
+<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]
+<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[
+-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<
+<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<
++>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+
+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++
+<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->
+>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+
+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[
+-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>
+>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<
+<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<
+<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>
+>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>
++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<
+<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]
+<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-
+<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<
+<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>
+>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>
+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]
+<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]
+<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[
+-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<
+<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<
++>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+
+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++
+<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>++<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>]>[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->
+>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+
+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[
+-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>
+>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<
+<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<
+<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>
+>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>
++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]>>[-]<<<<<<<<<<<<<<<[-]<<[-
+]>[->+<]<<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>[->>>>>>>>>>>>>+<<+<<<<<<<<<<<]>>
+>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<[->>>>>>>>+<<<+<<<<<]>>>>>[-<<<<<+>>>>>]
+>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[-]>>>>[-<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>]<[-<<<+>>+>]<[-]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[-
+>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<
++>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+
+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++
+<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
+>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>
+>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<
+<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+
+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<
+<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>
+>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>
+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[
+-]<<<<<<<<<[->>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<
+<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>
+>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>
+>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>
+>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]
+<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<[->>>>>>>>>+<+<<<
+<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<
+<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<
+<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<
+<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->
+[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]
+>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<[->>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<
+<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<
+<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>
+>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[
+->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<
+<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]
+<<<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>-<+<<]>>[-<<+
+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>
+>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<
+<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<
+]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[
+-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<[->>>>>>>>>+>>>>>
+>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<
+<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>
+>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[
+<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<
+<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>
+>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>
+]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<
+<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+
++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>
+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<
+<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>
+]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<
+<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>
+>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>
+>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]
+<<<<<<<<<[->>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>
+>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>
+[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>
+>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[
+-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<[->>>>>>>>>+<+<<<<<
+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<
+<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<
+<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<
+<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>
+]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-
+]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[
+-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<[->>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<
+<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<
+]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>
+>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->
+>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<
+<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>
+>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<
+<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>
+]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>
+>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<
+<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>
+>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<
+<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<
+<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<[->>>>>>>>>+>>>>>>>
+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[
+-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>
+>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<
+<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<
+<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>
+>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<
+<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<
++>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++<
+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
+>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<
++>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<
+<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<
+[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>
+++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>
+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<
+<<<<<<<[->>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<
+<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>
+>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-
+<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>
+>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]
+<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<[->>>>>>>>>+<+<<<<<<<
+<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<
+<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<
+<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[
+-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>
+>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]
+<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<
+<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<[->>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<
+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>
+>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>
++>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]>>[-]<<<<<<<<<<<<<<
+<<<<[-]<<[-]>[->+<]<<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>[->>>>>>>>>>>>>>>>+<<+
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<[->>>>>>>>>
+>>+<<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<<
+<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>]<[-<<<+>>+>]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>
+>>+<<<<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>
+]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<
+<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>
+>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>
+>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<
+]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<
++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<
+<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>
+>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>
+]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<
+<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<
+<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>
+>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]
+<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+
+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-
+<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]
+<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<
++<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>
+>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]
+>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<
+<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>
+>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<
+<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<
++>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->
+-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<
+<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<[->>
+>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<[->>>-<+<<]>>[-<
+<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->
+>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<
+<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<
+<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>
+>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<[->>>>
+>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>
+>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>
+[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->
++<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>
+>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<[->>
+>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>
+>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>
+[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>
+>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<
+<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<
+<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<
+<<<<<<[->>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>
+>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<
+<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<
+<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<
+<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>
+>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>
+>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<
+<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>
+]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<
+<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>
+>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>
+>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<
+<]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<
+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>
+>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>
++>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<<[-]++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]
+>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-]>[-]>>>>>[-
+<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[->>>+<<<]>>>[
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<<<<+>>>>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>
+>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>
+>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[-]+>>>>>>>>>
+[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<
+<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]<[<<<<<<<<[-
+<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[-]>[-<<<<+>>
++>>]<<[->>+<<]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>->>>>
+>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>[->>>>>>>>+>
++<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<[-]
+<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<[-]<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<[-]>>[-]<
+<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>>>>>]<<<<<[-
+>>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]<<<[-
+]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<<<+>>>]<<<[-
+>>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>
+>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>>+<<+<<<<<<<
+<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<
+<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<[
+-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>
+>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>->[-]]
+<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-]>[
+-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<
+<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[-]+>
+[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]>>>>>>>>>[-]
+]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<
+<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<
+<<<[-]>>[-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>[->+<<<<<<+>
+>>>>]<<<<<[->>>>>+<<<<<]>[->>>>>>+<<<<<<<+>]<[->+<]>>>>>>[->-[>+>>]>[+[-<+>]>+>>
+]<<<<<]<<<[-]>[-]>>>>>[-<<<<<<+>>>>>>]<[-<<<<+>>>+>]<[-]<<<<<<[-]>>>>[-]<[->++<<
+<<+>>>]<<<[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>
+>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<
+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<[->>>-<+<<]>>[-<<+>>]<<[->>>>>>>>>>>
+>+<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>
+>>>>>[-<<<<<<<+>>>>>>>]>>[-<[-<+<+>>]<<[->>+<<]>[>-<[-]]>>]<<<<<<<<<<[-]>>>>>>>>
+>[<<<<<<<<<[-]+>>>>>>>>>[-]]+<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<
+<+>>>>>>>>]>>[<<<<<<<<<<<<[->>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>
+>>>>]>->[-]]<[<<<<<<<<[-<<<->>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>
+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<
+<<<<<<<[-]>[-]>[-<<<<+>>+>>]<<[->>+<<]>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<[->>>->>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<
+<<<<<<<[-]+>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<<<<<<<<<[-]
+>>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>
+>>>]<[<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-]]<<<<<<<<<[-]>>[-]>>[-]<<<<<<<<<<<<<<<<<<<<<[-]<<[-]>[->+<]<<<<<<<<<[->>>>>
+>>>+<<<<<<<<]>>>>>>>>>>>>>>>>[-]<<<<<<<<[-<<<<<+>>>>>>>>>>>>>+<<<<<<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<[<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>
+>>>>[-]]<<<<<<<<[-]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>+>>>>>
+>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<[>>>>>>>>>+++++++++++++++++++++++++++++++++++
++++++++++++++.<<<<<<<<<[-]]>>>>>>>>>[-]<<<[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>+>>
+>>>>]<<<<<<[->>>>>>+<<<<<<]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>]<<<<<<<<<<<<[>>>>>>+++++++++++++++++++++++++++++++++++++++++++++++
++.<<<<<<[-]]>>>>>>[-]<<<[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>+>>>]<<<[->>>+<<<]<<<<<<
+<<<<<<<[->>>>>>>>>>>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<[>>>+++
++++++++++++++++++++++++++++++++++++++++++++++.<<<[-]]>>>[-]<<<<+++++++++++++++++
++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<[-]<-]<[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[-]>>>>>>[-]<<[-]<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]
@@ -0,0 +1,57 @@
+Towers of Hanoi for 15 disks by recursion on a stack of frames along the tape
+Prints every move; long pointer walks between frames
+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]+++++++++++++++>[-]+>[-]++>[-]+++<<<<[>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[>>>[-]<<<[
+-]]>>[-]+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>-[>>[-]<<[-]]>[-]+<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>--[>[-]<[-]]>>>[-<<<+<+>>>>]<<<<[->>>>+<<<<]>[<+
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]>[<<<<<<<<<<<<<<<<<[-]+>>>>
+>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>]>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>-
+<[-]]>[<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>-]>[-]]>>[-<<+<+>>>]<<<[->>>+<<<]>[<+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.+++
++++++++++++++++++++++++++++++++.+++++++.-----------------.----------------------
+-----------------------------------------------.++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++.+++++.++++++++++.--------.-----------------
+----------------------------------------------------------.[-]<<<<<<[-]+++++++++
++<<<<<<<<<<<<<<<<[->>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>]>[-<<<<<<<<+>>>>>>>+>]<[->+<]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>
+>]<<<<<]>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<[->>>>>>>>
+>>>>+<<<<<<<<<<<<<+>]<[-]>>>>>>>>[-][-]++++++++++>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>
+>+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>[-<<<<<<<<+>>>>>>>+>]<[->+<]<<<<<<<<[->-[>+>
+>]>[+[-<+>]>+>>]<<<<<]>>>>>>>>>>>>[-]>[-]<<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<[->>>>
+>>>>>>>+<<<<<<<<<<<<+>]<[-]>>>>>>>>[-]>>>>>>[-]<<<[-<<+<+>>>]<<<[->>>+<<<]>[-<+<
+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[>>>+++++++++++++++++++++++++++++++++++++++++++
++++++.<<<[-]]>>>[-]>[-<<<+<+>>>>]<<<<[->>>>+<<<<]>[-<+<<<<+>>>>>]<<<<<[->>>>>+<<
+<<<]>>>>[>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<[-]]>>>>[-]>++
+++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<[-]+++++++++++++++++++++++
++++++++++.++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+.++++++++++++.---.--.-----------------------------------------------------------
+------------------.[-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<+++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++.[-]++++++++++++++++++++++++++++++++.++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-
+----.---------------------------------------------------------------------------
+----.[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++.[-]++++++++++.[-]<<<<<<<<<<<<<[-]++>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<+<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]>>>>>>>>>>>-<<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<+<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]+>>>>>>>>>
+>>>>>>>>>[-]]>[-<+<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>[<<<<<<<<<<<<<<<
+<<[-]+>>>>>>>>>>>>>>>>>[-]]>>>[-]<[-]<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>]>[-<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<<<]
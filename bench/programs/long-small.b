@@ -0,0 +1,19 @@
+>+>+>+>+>++<[>[<+++>-
+
+ >>>>>
+ >+>+>+>+>++<[>[<+++>-
+
+   >>>>>
+   >+>+>+>+>++<[>[<+++>-
+
+     >>>>>
+     +++[->+++++<]>[-]<
+     <<<<<
+
+   ]<<]>[-]
+   <<<<<
+
+ ]<<]>[-]
+ <<<<<
+
+]<<]>.
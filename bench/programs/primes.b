@@ -0,0 +1,4 @@
+Primes up to 250 by trial division; prints each as three digits
+Exercises divmod loops and long runs of pointer moves
+
+>------->+<[->+>+>++<<[->>>>>+<<+<<<]>>>[-<<<+>>>]>>--[-<<<<<[->>>>>>>>+<<<<<+<<<]>>>[-<<<+>>>]<[->>>>>>>+<<<<<<+<]>[-<+>]>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[-]<<<<<<<+>>>>>>[[-]<<<<<<[-]>>>>>>]<<<<<<[[-]<<<[-]>>>]<<+>>>]<<<[-]<[[-]<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>[->>>>>>>>>>+<<<<<<<<<<]>[->>>+<<<]>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]>++++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<<]
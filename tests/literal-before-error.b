@@ -0,0 +1,4 @@
+At O1 the known byte is held back as a literal
+It has to be written before the move off the left edge of the tape fails
+
++.<
@@ -0,0 +1,4 @@
+At O1 the known bytes are held back as one literal across moves that stay on the tape
+It has to be written before the move off the left edge of the tape fails
+
++++.>++.<.<
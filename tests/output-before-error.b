@@ -0,0 +1,5 @@
+Output printed before a run fails must still come out ahead of the error
+The read leaves the cell unknown to the optimizer so the byte is printed by the run itself
+then the pointer moves left of the first cell
+
+,+.<